@@ -4,6 +4,7 @@
 
 #include "Display/FrameBuffer.hpp"
 #include "Engine/Consol3Engine.hpp"
+#include "Engine/Kernels/KernelRegistry.hpp"
 #include "Game/IGame.hpp"
 #include "Game/Raster/RasterGame.hpp"
 #include "Game/Voxel/VoxelGame.hpp"
@@ -23,12 +24,17 @@
 #include "Engine/Input/LinuxInputManager.hpp"
 #endif
 
+#include "Display/Multiplatform/BrailleFrameDrawer.hpp"
+#include "Display/Multiplatform/HalfBlockFrameDrawer.hpp"
 #include "Display/Multiplatform/TextOnlyFrameDrawer.hpp"
 #include "Display/Multiplatform/VT24BitFrameDrawer.hpp"
 #include "Display/Multiplatform/VT8BitFrameDrawer.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
 #include <iostream>
 #include <memory>
@@ -41,17 +47,47 @@ int main(int argc, char* argv[])
 {
     uint16_t width  = 150;
     uint16_t height = 150;
+    // the render resolution drops below the terminal's when frames take longer than this, in milliseconds, --frame-budget=0 turns it off
+    int64_t frame_time_budget = 33;
+    // the truecolor frame drawers keep writing a color while the next cells are within this of it, about the average difference per channel,
+    // --temporal-color-tolerance also keeps the cells of the last frame that are within it
+    uint8_t color_tolerance       = 0;
+    bool temporal_color_tolerance = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strncmp(argv[i], "--frame-budget=", std::strlen("--frame-budget=")) == 0)
+            frame_time_budget = std::atoll(argv[i] + std::strlen("--frame-budget="));
+        else if (std::strncmp(argv[i], "--color-tolerance=", std::strlen("--color-tolerance=")) == 0)
+            color_tolerance = (uint8_t)std::clamp(std::atoi(argv[i] + std::strlen("--color-tolerance=")), 0, 255);
+        else if (std::strcmp(argv[i], "--temporal-color-tolerance") == 0)
+            temporal_color_tolerance = true;
+    }
 
     // set current dir to executable dir so resource loading works as intended
     std::filesystem::path executable_path = std::filesystem::canonical(std::filesystem::path(argv[0])).parent_path();
     std::filesystem::current_path(executable_path);
 
+    // the hot loops run the versions for the best instruction set the cpu has, unless a lower one is asked for to compare them
+    Kernels::KernelRegistry& kernel_registry = Kernels::GetKernelRegistry();
+    Kernels::ISALevel requested_isa_level;
+
+    if (Kernels::GetRequestedISALevel(argc, argv, requested_isa_level))
+    {
+        kernel_registry.SetISALevel(requested_isa_level);
+        std::cerr << kernel_registry.GetBindingsReport();
+    }
+
     std::vector<std::shared_ptr<IFrameDrawer>> frame_drawers;
 
     std::shared_ptr<FrameBuffer<uint32_t>> uint32_t_framebuffer   = std::make_shared<FrameBuffer<uint32_t>>(width, height);
     std::shared_ptr<FrameBuffer<uint8_t>> uint8_t_framebuffer     = std::make_shared<FrameBuffer<uint8_t>>(width, height);
     std::shared_ptr<FrameBuffer<CHAR_INFO>> char_info_framebuffer = std::make_shared<FrameBuffer<CHAR_INFO>>(width, height);
     std::shared_ptr<FrameBuffer<char>> char_framebuffer           = std::make_shared<FrameBuffer<char>>(width, height);
+    // two pixels in every cell
+    std::shared_ptr<FrameBuffer<uint32_t>> half_block_framebuffer = std::make_shared<FrameBuffer<uint32_t>>(width, height * 2);
+    // 2x4 pixels in every cell
+    std::shared_ptr<FrameBuffer<uint32_t>> braille_framebuffer = std::make_shared<FrameBuffer<uint32_t>>(width * 2, height * 4);
 
     std::shared_ptr<Engine::Input::IInputManager> input_manager;
     std::shared_ptr<Game::IGame> game;
@@ -68,8 +104,11 @@ int main(int argc, char* argv[])
     frame_drawers.emplace_back(std::make_shared<Windows::DitheredGreyscaleFrameDrawer>(char_info_framebuffer));
     frame_drawers.emplace_back(std::make_shared<Windows::DitheredFrameDrawer>(char_info_framebuffer));
 
+    std::shared_ptr<Multiplatform::VT24BitFrameDrawer<CHAR_INFO>> vt24bit_frame_drawer = std::make_shared<Multiplatform::VT24BitFrameDrawer<CHAR_INFO>>(uint32_t_framebuffer, windows_terminal);
+    vt24bit_frame_drawer->SetColorTolerance(color_tolerance, temporal_color_tolerance);
+
     frame_drawers.emplace_back(std::make_shared<Multiplatform::VT8BitFrameDrawer<CHAR_INFO>>(uint8_t_framebuffer, windows_terminal));
-    frame_drawers.emplace_back(std::make_shared<Multiplatform::VT24BitFrameDrawer<CHAR_INFO>>(uint32_t_framebuffer, windows_terminal));
+    frame_drawers.emplace_back(vt24bit_frame_drawer);
 
     input_manager = std::make_shared<Engine::Input::WindowsInputManager>();
 
@@ -77,9 +116,17 @@ int main(int argc, char* argv[])
     // multiplatform frame drawers need to be given a terminal manager
     std::shared_ptr<ITerminalManager<char>> linux_terminal_manager = std::make_shared<Linux::LinuxTerminalManager>(width, height);
 
-    frame_drawers.emplace_back(std::make_shared<Multiplatform::VT24BitFrameDrawer<char>>(uint32_t_framebuffer, linux_terminal_manager));
+    std::shared_ptr<Multiplatform::VT24BitFrameDrawer<char>> vt24bit_frame_drawer      = std::make_shared<Multiplatform::VT24BitFrameDrawer<char>>(uint32_t_framebuffer, linux_terminal_manager);
+    std::shared_ptr<Multiplatform::HalfBlockFrameDrawer<char>> half_block_frame_drawer = std::make_shared<Multiplatform::HalfBlockFrameDrawer<char>>(half_block_framebuffer, linux_terminal_manager);
+    vt24bit_frame_drawer->SetColorTolerance(color_tolerance, temporal_color_tolerance);
+    half_block_frame_drawer->SetColorTolerance(color_tolerance, temporal_color_tolerance);
+
+    frame_drawers.emplace_back(vt24bit_frame_drawer);
+    frame_drawers.emplace_back(half_block_frame_drawer);
     frame_drawers.emplace_back(std::make_shared<Multiplatform::VT8BitFrameDrawer<char>>(uint8_t_framebuffer, linux_terminal_manager));
     frame_drawers.emplace_back(std::make_shared<Multiplatform::TextOnlyFrameDrawer<char>>(char_framebuffer, linux_terminal_manager));
+    frame_drawers.emplace_back(std::make_shared<Multiplatform::BrailleFrameDrawer<char>>(braille_framebuffer, linux_terminal_manager, false));
+    frame_drawers.emplace_back(std::make_shared<Multiplatform::BrailleFrameDrawer<char>>(braille_framebuffer, linux_terminal_manager, true));
 
     input_manager = std::make_shared<Engine::Input::LinuxInputManager>();
 #endif
@@ -93,6 +140,7 @@ int main(int argc, char* argv[])
 #endif
 
     Consol3Engine engine = Consol3Engine(game, input_manager);
+    engine.SetFrameTimeBudget(frame_time_budget);
 
     for (const std::shared_ptr<IFrameDrawer>& frame_drawer : frame_drawers)
         engine.RegisterFrameDrawer(frame_drawer);
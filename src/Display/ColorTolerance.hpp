@@ -0,0 +1,30 @@
+#ifndef COLORTOLERANCE_HPP
+#define COLORTOLERANCE_HPP
+
+#include "RGBColor.hpp"
+
+#include <cstdint>
+
+namespace Display
+{
+    // a color is kept for the next cells while they are within the tolerance of it, and when temporal a cell is kept from the last frame while
+    // it is within the tolerance of it, 0 writes every color exactly
+    struct ColorTolerance
+    {
+        uint8_t tolerance = 0;
+        bool temporal     = false;
+
+        [[nodiscard]] inline constexpr bool IsCloseColor(uint32_t color, uint32_t other) const
+        {
+            return color == other || (tolerance > 0 && RGBColor::IsHexWithinTolerance(color, other, tolerance));
+        }
+
+        // whether a cell doesn't have to be written again over the color of the last frame
+        [[nodiscard]] inline constexpr bool IsSameColor(uint32_t color, uint32_t previous_color) const
+        {
+            return temporal ? IsCloseColor(color, previous_color) : color == previous_color;
+        }
+    };
+}
+
+#endif
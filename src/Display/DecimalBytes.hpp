@@ -0,0 +1,47 @@
+#ifndef DECIMALBYTES_HPP
+#define DECIMALBYTES_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace Display
+{
+    // the decimal digits of a byte followed by a ';', the parameters of the escape sequences are written from these instead of being formatted
+    struct DecimalByte
+    {
+        char chars[4];
+        uint8_t len;
+    };
+
+    static constexpr std::array<DecimalByte, 256> decimal_bytes = []()
+    {
+        std::array<DecimalByte, 256> table{};
+
+        for (uint16_t value = 0; value < 256; value++)
+        {
+            DecimalByte& decimal_byte = table[value];
+
+            if (value >= 100)
+                decimal_byte.chars[decimal_byte.len++] = (char)('0' + value / 100);
+            if (value >= 10)
+                decimal_byte.chars[decimal_byte.len++] = (char)('0' + value / 10 % 10);
+
+            decimal_byte.chars[decimal_byte.len++] = (char)('0' + value % 10);
+            decimal_byte.chars[decimal_byte.len++] = ';';
+        }
+
+        return table;
+    }();
+
+    // always copies all 4 chars and only moves out past the used ones, so out needs 4 chars of room even for a short value
+    inline void WriteDecimalByte(char*& out, uint8_t value)
+    {
+        const DecimalByte& decimal_byte = decimal_bytes[value];
+
+        std::memcpy(out, decimal_byte.chars, sizeof(decimal_byte.chars));
+        out += decimal_byte.len;
+    }
+}
+
+#endif
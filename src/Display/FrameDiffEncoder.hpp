@@ -0,0 +1,197 @@
+#ifndef FRAMEDIFFENCODER_HPP
+#define FRAMEDIFFENCODER_HPP
+
+#include "Display/WorkerPool.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Display
+{
+    // encodes a frame for a terminal as the runs of cells that changed since the last encoded frame, each run starts with a cursor move, a row is
+    // written whole when that's shorter than its runs, the first frame and the frames after Invalidate are written whole
+    // the rows are encoded in bands on the frame encode workers, each band into its own buffer and starting without a last cell so it sets its
+    // own colors, the bands are written to the terminal in order
+    template<typename T>
+    class FrameDiffEncoder
+    {
+    private:
+        uint16_t width  = 0;
+        uint16_t height = 0;
+
+        std::vector<T> previous_cells;
+        bool has_previous = false;
+
+        uint16_t band_rows = 0;
+        std::vector<std::vector<char>> band_buffers;
+        std::vector<std::string_view> band_strings;
+
+        // unchanged cells between two changed ones are rewritten instead of moving the cursor over them when the gap is at most this long,
+        // about the length of a cursor move
+        static constexpr uint16_t max_bridged_gap = 6;
+        // fewer rows aren't worth handing to a worker
+        static constexpr uint16_t min_band_rows = 8;
+
+        static void WriteCursorPosition(char*& out, uint16_t x, uint16_t y)
+        {
+            *out++ = '\x1b';
+            *out++ = '[';
+            out    = std::to_chars(out, out + 5, y + 1).ptr;
+            *out++ = ';';
+            out    = std::to_chars(out, out + 5, x + 1).ptr;
+            *out++ = 'H';
+        }
+
+        // the room a band needs, when no cell is written longer than max_cell_len: every row whole and one more with a cursor move per cell
+        [[nodiscard]] static size_t GetMaxEncodedSize(uint16_t width, uint16_t height, size_t max_cell_len)
+        {
+            static constexpr size_t max_cursor_position_len = 14;
+
+            return ((size_t)height + 1) * width * (max_cell_len + max_cursor_position_len) + max_cursor_position_len * height;
+        }
+
+        template<typename EncodeCell, typename IsSameCell>
+        char* EncodeRows(const T* cells, char* out, uint16_t start_row, uint16_t end_row, EncodeCell& encode_cell, IsSameCell& is_same_cell)
+        {
+            std::optional<T> last_cell;
+
+            for (uint16_t y = start_row; y < end_row; y++)
+            {
+                const T* row_cells             = cells + (size_t)y * width;
+                T* row_previous_cells          = previous_cells.data() + (size_t)y * width;
+                char* row_start                = out;
+                std::optional<T> row_last_cell = last_cell;
+
+                WriteCursorPosition(out, 0, y);
+
+                for (uint16_t x = 0; x < width; x++)
+                    encode_cell(out, row_cells[x], row_last_cell);
+
+                if (has_previous)
+                {
+                    // the runs are written after the whole row, and moved over it when they're shorter
+                    char* diff_start                = out;
+                    std::optional<T> diff_last_cell = last_cell;
+
+                    uint16_t x = 0;
+
+                    while (x < width)
+                    {
+                        if (is_same_cell(row_cells[x], row_previous_cells[x]))
+                        {
+                            x++;
+                            continue;
+                        }
+
+                        uint16_t run_end = x + 1;
+
+                        while (run_end < width)
+                        {
+                            if (!is_same_cell(row_cells[run_end], row_previous_cells[run_end]))
+                            {
+                                run_end++;
+                                continue;
+                            }
+
+                            uint16_t next_changed = run_end;
+
+                            while (next_changed < width && next_changed - run_end <= max_bridged_gap && is_same_cell(row_cells[next_changed], row_previous_cells[next_changed]))
+                                next_changed++;
+
+                            if (next_changed == width || next_changed - run_end > max_bridged_gap)
+                                break;
+
+                            run_end = next_changed;
+                        }
+
+                        WriteCursorPosition(out, x, y);
+
+                        // the bridged cells are written too, so they are what's on the terminal now even when they were close enough to skip
+                        for (; x < run_end; x++)
+                        {
+                            encode_cell(out, row_cells[x], diff_last_cell);
+                            row_previous_cells[x] = row_cells[x];
+                        }
+                    }
+
+                    size_t diff_len = out - diff_start;
+
+                    if (diff_len < (size_t)(diff_start - row_start))
+                    {
+                        std::memmove(row_start, diff_start, diff_len);
+                        out       = row_start + diff_len;
+                        last_cell = diff_last_cell;
+
+                        // the skipped cells keep the previous ones, which are still on the terminal
+                        continue;
+                    }
+
+                    out = diff_start;
+                }
+
+                last_cell = row_last_cell;
+                std::copy(row_cells, row_cells + width, row_previous_cells);
+            }
+
+            return out;
+        }
+
+    public:
+        // max_cell_len is the most a cell is written with
+        void Resize(uint16_t width, uint16_t height, size_t max_cell_len)
+        {
+            this->width  = width;
+            this->height = height;
+
+            previous_cells.assign((size_t)width * height, T());
+            has_previous = false;
+
+            uint16_t band_count = (uint16_t)std::clamp(height / min_band_rows, 1, (int)GetFrameEncodeWorkerPool().GetThreadCount());
+            band_rows           = (uint16_t)((height + band_count - 1) / band_count);
+
+            band_buffers.assign(band_count, std::vector<char>(GetMaxEncodedSize(width, band_rows, max_cell_len)));
+            band_strings.assign(band_count, std::string_view());
+        }
+
+        // the terminal no longer shows the last frame, after it's set up again or another frame drawer wrote to it
+        void Invalidate()
+        {
+            has_previous = false;
+        }
+
+        // encode_cell(char*& out, const T& cell, std::optional<T>& last_cell) writes a cell, last_cell is the cell written before it in this band so
+        // the attributes (the colors) that are still set don't have to be written again
+        // is_same_cell(const T& cell, const T& previous_cell) tells whether a cell changed, a cell that is the same keeps the previous one so
+        // changes smaller than what is_same_cell allows don't add up
+        // both are called from the workers at the same time, returns the encoded bands which stay valid until the next Encode
+        template<typename EncodeCell, typename IsSameCell = std::equal_to<T>>
+        std::span<const std::string_view> Encode(const T* cells, EncodeCell encode_cell, IsSameCell is_same_cell = IsSameCell())
+        {
+            auto encode_band = [&](uint16_t band)
+            {
+                uint16_t start_row = (uint16_t)(band * band_rows);
+                uint16_t end_row   = (uint16_t)std::min<uint32_t>(height, start_row + band_rows);
+
+                char* band_start = band_buffers[band].data();
+                char* band_end   = EncodeRows(cells, band_start, start_row, end_row, encode_cell, is_same_cell);
+
+                band_strings[band] = std::string_view(band_start, band_end - band_start);
+            };
+
+            GetFrameEncodeWorkerPool().Run((uint16_t)band_buffers.size(), encode_band);
+
+            has_previous = true;
+
+            return band_strings;
+        }
+    };
+}
+
+#endif
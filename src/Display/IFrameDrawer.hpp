@@ -28,8 +28,8 @@ namespace Display
 
         virtual void ReportInformation(const std::string& info) = 0;
 
-        [[nodiscard]] virtual const uint16_t GetFrameBufferWidth() const  = 0;
-        [[nodiscard]] virtual const uint16_t GetFrameBufferHeight() const = 0;
+        [[nodiscard]] virtual uint16_t GetFrameBufferWidth() const  = 0;
+        [[nodiscard]] virtual uint16_t GetFrameBufferHeight() const = 0;
     };
 }
 
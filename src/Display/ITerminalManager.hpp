@@ -3,8 +3,10 @@
 
 #include "RGBColor.hpp"
 
+#include <span>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 
 namespace Display
 {
@@ -28,9 +30,9 @@ namespace Display
 
         virtual void WriteFrameBufferData(const T* data) = 0;
         /**
-         * This call can contain ansi escape sequences, growing larger than the framebuffer size
+         * The strings are written one after the other as a frame, they can contain ansi escape sequences, growing larger than the framebuffer size
          */
-        virtual void WriteSizedString(const std::string& string, uint64_t size) = 0;
+        virtual void WriteStrings(std::span<const std::string_view> strings) = 0;
     };
 }
 
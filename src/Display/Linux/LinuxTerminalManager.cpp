@@ -1,13 +1,60 @@
+#ifdef SYS_LINUX
+
 #include "LinuxTerminalManager.hpp"
 
+#include <cerrno>
 #include <cstdint>
-#include <cstdio>
 #include <iostream>
+#include <poll.h>
+#include <unistd.h>
 
 namespace Display
 {
     namespace Linux
     {
+        // the terminal shows the frame once all of it arrived between these (synchronized output), terminals that don't know it ignore them
+        static constexpr char frame_start[] = "\033[?2026h\033[0;0H";
+        static constexpr char frame_end[]   = "\033[?2026l";
+
+        // writev can write only a part of the buffers, or nothing with EAGAIN when stdout is non-blocking
+        static void WriteAll(int fd, iovec* buffers, int buffer_count)
+        {
+            while (buffer_count > 0)
+            {
+                ssize_t written = writev(fd, buffers, buffer_count);
+
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                    {
+                        pollfd writable_fd = {fd, POLLOUT, 0};
+                        poll(&writable_fd, 1, -1);
+                        continue;
+                    }
+
+                    // the terminal is gone, the rest of the frame is dropped
+                    return;
+                }
+
+                // skip the buffers that were written whole and continue from where the next one was cut off
+                while (buffer_count > 0 && (size_t)written >= buffers->iov_len)
+                {
+                    written -= buffers->iov_len;
+                    buffers++;
+                    buffer_count--;
+                }
+
+                if (buffer_count > 0)
+                {
+                    buffers->iov_base = (char*)buffers->iov_base + written;
+                    buffers->iov_len -= written;
+                }
+            }
+        }
+
         LinuxTerminalManager::LinuxTerminalManager(short width, short height) : width(width), height(height)
         {
         }
@@ -32,7 +79,8 @@ namespace Display
 
         void LinuxTerminalManager::SetTitle(const std::string& title)
         {
-            std::cout << "\033]2;" << title << "\007";
+            // flushed since the frames that would flush it aren't written while the scene doesn't change
+            std::cout << "\033]2;" << title << "\007" << std::flush;
         }
 
         void LinuxTerminalManager::EnableCursor()
@@ -46,18 +94,28 @@ namespace Display
 
         void LinuxTerminalManager::WriteFrameBufferData(const char* data)
         {
-            // clear screen
-            std::cout << "\033[0;0H";
+            std::string_view frame(data, (size_t)width * height);
 
-            printf("%s", data);
+            WriteStrings(std::span<const std::string_view>(&frame, 1));
         }
 
-        void LinuxTerminalManager::WriteSizedString(const std::string& string, uint64_t size)
+        void LinuxTerminalManager::WriteStrings(std::span<const std::string_view> strings)
         {
-            // clear screen
-            std::cout << "\033[0;0H";
-            printf("%s", string.c_str());
+            // what was written through std::cout (the title) goes out before the frame
+            std::cout.flush();
+
+            frame_buffers.clear();
+            frame_buffers.push_back({(void*)frame_start, sizeof(frame_start) - 1});
+
+            for (std::string_view string : strings)
+                frame_buffers.push_back({(void*)string.data(), string.size()});
+
+            frame_buffers.push_back({(void*)frame_end, sizeof(frame_end) - 1});
+
+            WriteAll(STDOUT_FILENO, frame_buffers.data(), (int)frame_buffers.size());
         }
     }
 
 }
+
+#endif
@@ -5,6 +5,8 @@
 
 #include <cstdint>
 #include <string>
+#include <sys/uio.h>
+#include <vector>
 
 namespace Display
 {
@@ -16,6 +18,9 @@ namespace Display
             short width;
             short height;
 
+            // the synchronized output sequences around the strings of a frame, written with one writev
+            std::vector<iovec> frame_buffers;
+
         public:
             LinuxTerminalManager(short width, short height);
             ~LinuxTerminalManager();
@@ -29,7 +34,7 @@ namespace Display
             virtual void EnableCursor() override;
 
             virtual void WriteFrameBufferData(const char* data) override;
-            virtual void WriteSizedString(const std::string& string, uint64_t size) override;
+            virtual void WriteStrings(std::span<const std::string_view> strings) override;
         };
     }
 
@@ -0,0 +1,182 @@
+#include "BrailleFrameDrawer.hpp"
+
+#include <cstring>
+
+#ifdef SYS_WINDOWS
+// Windows.h overrides std::min
+#define NOMINMAX
+#include <Windows.h>
+#elif defined(SYS_LINUX)
+#include "Display/Windows/WindowsStructsForLinux.hpp"
+#endif
+
+namespace Display
+{
+    namespace Multiplatform
+    {
+        // the bit of every dot of a braille pattern, by the row and the column of its pixel in the cell
+        static constexpr uint8_t braille_dot_bits[4][2] = {
+            {0x01, 0x08},
+            {0x02, 0x10},
+            {0x04, 0x20},
+            {0x40, 0x80},
+        };
+
+        // the luminance a pixel has to be over to set its dot, the 2x4 corner of a 4x4 bayer matrix spread over 0-255
+        static constexpr float braille_dot_thresholds[4][2] = {
+            {16.0f, 144.0f},
+            {208.0f, 80.0f},
+            {48.0f, 176.0f},
+            {240.0f, 112.0f},
+        };
+
+        template<typename T>
+        BrailleFrameDrawer<T>::BrailleFrameDrawer(std::shared_ptr<FrameBuffer<uint32_t>> framebuffer, std::shared_ptr<ITerminalManager<T>> terminal_manager, bool colored) :
+            framebuffer(std::move(framebuffer)),
+            terminal_manager(std::move(terminal_manager)),
+            colored(colored)
+        {
+            this->framebuffer->FillBuffer(0x000000);
+
+            cell_columns = this->framebuffer->GetWidth() / 2;
+            cell_rows    = this->framebuffer->GetHeight() / 4;
+            cells        = std::vector<uint32_t>((size_t)cell_columns * cell_rows, 0);
+
+            diff_encoder.Resize(cell_columns, cell_rows, max_cell_len);
+        }
+
+        template<typename T>
+        void BrailleFrameDrawer<T>::SetupFrameDrawer()
+        {
+            terminal_manager->SetupTerminalManager();
+            diff_encoder.Invalidate();
+        }
+
+        template<typename T>
+        void BrailleFrameDrawer<T>::SetPixel(uint16_t x, uint16_t y, RGBColor color)
+        {
+            framebuffer->SetValue(x, y, color.GetHexValues());
+        }
+
+        template<typename T>
+        std::span<const std::string_view> BrailleFrameDrawer<T>::TranslateFrameBuffer()
+        {
+            for (uint16_t cell_y = 0; cell_y < cell_rows; cell_y++)
+            {
+                for (uint16_t cell_x = 0; cell_x < cell_columns; cell_x++)
+                {
+                    uint8_t dots       = 0;
+                    uint8_t set_dots   = 0;
+                    uint32_t red_sum   = 0;
+                    uint32_t green_sum = 0;
+                    uint32_t blue_sum  = 0;
+
+                    for (uint8_t dot_y = 0; dot_y < 4; dot_y++)
+                    {
+                        for (uint8_t dot_x = 0; dot_x < 2; dot_x++)
+                        {
+                            uint32_t color = framebuffer->GetValue(cell_x * 2 + dot_x, cell_y * 4 + dot_y);
+
+                            if (RGBColor::GetGreyscaleFromHex(color) <= braille_dot_thresholds[dot_y][dot_x])
+                                continue;
+
+                            dots |= braille_dot_bits[dot_y][dot_x];
+
+                            red_sum += color >> 16;
+                            green_sum += color >> 8 & 0xFF;
+                            blue_sum += color & 0xFF;
+                            set_dots++;
+                        }
+                    }
+
+                    uint32_t cell_color = 0;
+
+                    if (colored && set_dots > 0)
+                        cell_color = RGBColor(red_sum / set_dots, green_sum / set_dots, blue_sum / set_dots).GetHexValues();
+
+                    cells[(size_t)cell_y * cell_columns + cell_x] = cell_color << 8 | dots;
+                }
+            }
+
+            auto encode_cell = [this](char*& out, uint32_t cell, std::optional<uint32_t>& last_cell)
+            {
+                uint32_t color = cell >> 8;
+                uint8_t dots   = (uint8_t)cell;
+
+                // always reset the colors on the first cell
+                if (!last_cell)
+                {
+                    std::memcpy(out, reset_esc_sequence, reset_esc_sequence_len);
+                    out += reset_esc_sequence_len;
+                }
+
+                // a cell without dots doesn't show its color, the next one might still use the current one
+                if (dots == 0)
+                {
+                    if (!last_cell)
+                        last_cell = cell;
+
+                    *out++ = ' ';
+                    return;
+                }
+
+                if (colored && (!last_cell || color != *last_cell >> 8))
+                {
+                    RGBColor rgbcolor = RGBColor(color);
+
+                    std::memcpy(out, fg_esc_sequence_start, esc_sequence_start_len);
+                    out += esc_sequence_start_len;
+
+                    WriteDecimalByte(out, rgbcolor.r);
+                    WriteDecimalByte(out, rgbcolor.g);
+                    WriteDecimalByte(out, rgbcolor.b);
+                    out[-1] = 'm';
+                }
+
+                last_cell = cell;
+
+                // U+2800 plus the dots in utf-8
+                *out++ = '\xe2';
+                *out++ = (char)(0xA0 | dots >> 6);
+                *out++ = (char)(0x80 | (dots & 0x3F));
+            };
+
+            return diff_encoder.Encode(cells.data(), encode_cell);
+        }
+
+        template<typename T>
+        void BrailleFrameDrawer<T>::DisplayFrame()
+        {
+            terminal_manager->WriteStrings(TranslateFrameBuffer());
+        }
+
+        template<typename T>
+        void BrailleFrameDrawer<T>::ReportInformation(const std::string& info)
+        {
+            terminal_manager->SetTitle(info + (colored ? " | Braille color" : " | Braille"));
+        }
+
+        template<typename T>
+        void BrailleFrameDrawer<T>::ClearFrameBuffer()
+        {
+            this->framebuffer->FillBuffer(0x000000);
+        }
+
+        template<typename T>
+        uint16_t BrailleFrameDrawer<T>::GetFrameBufferWidth() const
+        {
+            return framebuffer->GetWidth();
+        }
+
+        template<typename T>
+        uint16_t BrailleFrameDrawer<T>::GetFrameBufferHeight() const
+        {
+            return framebuffer->GetHeight();
+        }
+
+        // nothing in the constructors differs between the terminal types, so they are instantiated here instead of being specialized
+        template class BrailleFrameDrawer<char>;
+        template class BrailleFrameDrawer<CHAR_INFO>;
+    }
+
+}
@@ -0,0 +1,73 @@
+#ifndef BRAILLEFRAMEDRAWER_HPP
+#define BRAILLEFRAMEDRAWER_HPP
+
+#include "Display/DecimalBytes.hpp"
+#include "Display/FrameBuffer.hpp"
+#include "Display/FrameDiffEncoder.hpp"
+#include "Display/IFrameDrawer.hpp"
+#include "Display/ITerminalManager.hpp"
+#include "Display/RGBColor.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Display
+{
+    namespace Multiplatform
+    {
+        // draws 2x4 pixels in every cell as a braille pattern, a dot is set when the luminance of its pixel is over an ordered dither threshold,
+        // so the framebuffer has twice the columns and four times the rows of the terminal, colored gives every cell the average color of its
+        // set dots as the foreground
+        template<typename T>
+        class BrailleFrameDrawer : public IFrameDrawer
+        {
+        private:
+            std::shared_ptr<FrameBuffer<uint32_t>> framebuffer;
+            std::shared_ptr<ITerminalManager<T>> terminal_manager;
+
+            const bool colored;
+
+            // the color in the high 24 bits and the dots in the low 8
+            std::vector<uint32_t> cells;
+            uint16_t cell_columns;
+            uint16_t cell_rows;
+
+            // only the cells that changed since the last frame are written
+            FrameDiffEncoder<uint32_t> diff_encoder;
+
+            // the colors another frame drawer left the terminal with are reset at the start of every frame
+            static constexpr char reset_esc_sequence[]     = "\x1b[0m";
+            static constexpr size_t reset_esc_sequence_len = sizeof(reset_esc_sequence) - 1;
+            // the last parameter is written with its ';' which is then replaced by the 'm'
+            static constexpr char fg_esc_sequence_start[]  = "\x1b[38;2;";
+            static constexpr size_t esc_sequence_start_len = sizeof(fg_esc_sequence_start) - 1;
+            // the reset, the escape sequence with 3 digits for every channel and a pattern of 3 bytes in utf-8
+            static constexpr size_t max_cell_len = reset_esc_sequence_len + esc_sequence_start_len + 12 + 3;
+
+            std::span<const std::string_view> TranslateFrameBuffer();
+
+        public:
+            // the framebuffer has to be twice as wide and four times as high as the terminal
+            BrailleFrameDrawer(std::shared_ptr<FrameBuffer<uint32_t>> framebuffer, std::shared_ptr<ITerminalManager<T>> terminal_manager, bool colored);
+
+            virtual void SetupFrameDrawer() override;
+
+            virtual void SetPixel(uint16_t x, uint16_t y, RGBColor color) override;
+
+            virtual void DisplayFrame() override;
+
+            virtual void ClearFrameBuffer() override;
+
+            virtual void ReportInformation(const std::string& info) override;
+
+            [[nodiscard]] virtual uint16_t GetFrameBufferWidth() const override;
+            [[nodiscard]] virtual uint16_t GetFrameBufferHeight() const override;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,172 @@
+#include "HalfBlockFrameDrawer.hpp"
+
+#include <cstring>
+
+#ifdef SYS_WINDOWS
+// Windows.h overrides std::min
+#define NOMINMAX
+#include <Windows.h>
+#elif defined(SYS_LINUX)
+#include "Display/Windows/WindowsStructsForLinux.hpp"
+#endif
+
+namespace Display
+{
+    namespace Multiplatform
+    {
+        template<typename T>
+        HalfBlockFrameDrawer<T>::HalfBlockFrameDrawer(std::shared_ptr<FrameBuffer<uint32_t>> framebuffer, std::shared_ptr<ITerminalManager<T>> terminal_manager) :
+            framebuffer(std::move(framebuffer)),
+            terminal_manager(std::move(terminal_manager))
+        {
+            this->framebuffer->FillBuffer(0x000000);
+
+            cell_rows = this->framebuffer->GetHeight() / 2;
+            cells     = std::vector<uint64_t>((size_t)this->framebuffer->GetWidth() * cell_rows, 0);
+
+            diff_encoder.Resize(this->framebuffer->GetWidth(), cell_rows, max_cell_len);
+        }
+
+        template<typename T>
+        void HalfBlockFrameDrawer<T>::SetColorTolerance(uint8_t color_tolerance, bool temporal_color_tolerance)
+        {
+            this->color_tolerance = {color_tolerance, temporal_color_tolerance};
+
+            diff_encoder.Invalidate();
+        }
+
+        template<typename T>
+        void HalfBlockFrameDrawer<T>::SetupFrameDrawer()
+        {
+            terminal_manager->SetupTerminalManager();
+            diff_encoder.Invalidate();
+        }
+
+        template<typename T>
+        void HalfBlockFrameDrawer<T>::SetPixel(uint16_t x, uint16_t y, RGBColor color)
+        {
+            framebuffer->SetValue(x, y, color.GetHexValues());
+        }
+
+        template<typename T>
+        std::span<const std::string_view> HalfBlockFrameDrawer<T>::TranslateFrameBuffer()
+        {
+            uint16_t width = framebuffer->GetWidth();
+
+            for (uint16_t y = 0; y < cell_rows; y++)
+            {
+                const uint32_t* top_row    = framebuffer->GetFrameBufferData() + (size_t)(y * 2) * width;
+                const uint32_t* bottom_row = top_row + width;
+                uint64_t* cell_row         = cells.data() + (size_t)y * width;
+
+                for (uint16_t x = 0; x < width; x++)
+                    cell_row[x] = ((uint64_t)top_row[x] << 32) | bottom_row[x];
+            }
+
+            auto write_color = [](char*& out, const char* esc_sequence_start, uint32_t color)
+            {
+                RGBColor rgbcolor = RGBColor(color);
+
+                std::memcpy(out, esc_sequence_start, esc_sequence_start_len);
+                out += esc_sequence_start_len;
+
+                WriteDecimalByte(out, rgbcolor.r);
+                WriteDecimalByte(out, rgbcolor.g);
+                WriteDecimalByte(out, rgbcolor.b);
+                out[-1] = 'm';
+            };
+
+            ColorTolerance color_tolerance = this->color_tolerance;
+
+            // last_colors isn't the last cell but the foreground and background colors the terminal is left with, packed the same way
+            auto encode_cell = [&write_color, color_tolerance](char*& out, uint64_t cell, std::optional<uint64_t>& last_colors)
+            {
+                uint32_t top    = (uint32_t)(cell >> 32);
+                uint32_t bottom = (uint32_t)cell;
+
+                // always set both colors on the first cell
+                if (!last_colors)
+                {
+                    write_color(out, fg_esc_sequence_start, top);
+                    write_color(out, bg_esc_sequence_start, bottom);
+                    last_colors = cell;
+                }
+
+                uint32_t fg = (uint32_t)(*last_colors >> 32);
+                uint32_t bg = (uint32_t)*last_colors;
+
+                // a cell of one color is a space, so only the background has to match
+                if (color_tolerance.IsCloseColor(top, bottom))
+                {
+                    if (!color_tolerance.IsCloseColor(bg, bottom))
+                    {
+                        write_color(out, bg_esc_sequence_start, bottom);
+                        last_colors = ((uint64_t)fg << 32) | bottom;
+                    }
+
+                    *out++ = ' ';
+                    return;
+                }
+
+                if (!color_tolerance.IsCloseColor(fg, top))
+                {
+                    write_color(out, fg_esc_sequence_start, top);
+                    fg = top;
+                }
+
+                if (!color_tolerance.IsCloseColor(bg, bottom))
+                {
+                    write_color(out, bg_esc_sequence_start, bottom);
+                    bg = bottom;
+                }
+
+                last_colors = ((uint64_t)fg << 32) | bg;
+
+                std::memcpy(out, upper_half_block, upper_half_block_len);
+                out += upper_half_block_len;
+            };
+
+            auto is_same_cell = [color_tolerance](uint64_t cell, uint64_t previous_cell)
+            {
+                return color_tolerance.IsSameColor((uint32_t)(cell >> 32), (uint32_t)(previous_cell >> 32)) && color_tolerance.IsSameColor((uint32_t)cell, (uint32_t)previous_cell);
+            };
+
+            return diff_encoder.Encode(cells.data(), encode_cell, is_same_cell);
+        }
+
+        template<typename T>
+        void HalfBlockFrameDrawer<T>::DisplayFrame()
+        {
+            terminal_manager->WriteStrings(TranslateFrameBuffer());
+        }
+
+        template<typename T>
+        void HalfBlockFrameDrawer<T>::ReportInformation(const std::string& info)
+        {
+            terminal_manager->SetTitle(info + " | HalfBlock");
+        }
+
+        template<typename T>
+        void HalfBlockFrameDrawer<T>::ClearFrameBuffer()
+        {
+            this->framebuffer->FillBuffer(0x000000);
+        }
+
+        template<typename T>
+        uint16_t HalfBlockFrameDrawer<T>::GetFrameBufferWidth() const
+        {
+            return framebuffer->GetWidth();
+        }
+
+        template<typename T>
+        uint16_t HalfBlockFrameDrawer<T>::GetFrameBufferHeight() const
+        {
+            return framebuffer->GetHeight();
+        }
+
+        // nothing in the constructors differs between the terminal types, so they are instantiated here instead of being specialized
+        template class HalfBlockFrameDrawer<char>;
+        template class HalfBlockFrameDrawer<CHAR_INFO>;
+    }
+
+}
@@ -0,0 +1,75 @@
+#ifndef HALFBLOCKFRAMEDRAWER_HPP
+#define HALFBLOCKFRAMEDRAWER_HPP
+
+#include "Display/ColorTolerance.hpp"
+#include "Display/DecimalBytes.hpp"
+#include "Display/FrameBuffer.hpp"
+#include "Display/FrameDiffEncoder.hpp"
+#include "Display/IFrameDrawer.hpp"
+#include "Display/ITerminalManager.hpp"
+#include "Display/RGBColor.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Display
+{
+    namespace Multiplatform
+    {
+        // draws two vertically adjacent pixels in every cell as a '▀' with the top pixel as the foreground color and the bottom one as the
+        // background, so the framebuffer has twice the rows of the terminal
+        template<typename T>
+        class HalfBlockFrameDrawer : public IFrameDrawer
+        {
+        private:
+            std::shared_ptr<FrameBuffer<uint32_t>> framebuffer;
+            std::shared_ptr<ITerminalManager<T>> terminal_manager;
+
+            // the top color in the high 32 bits and the bottom color in the low ones
+            std::vector<uint64_t> cells;
+            uint16_t cell_rows;
+
+            ColorTolerance color_tolerance;
+
+            // only the cells that changed since the last frame are written
+            FrameDiffEncoder<uint64_t> diff_encoder;
+
+            // the last parameter is written with its ';' which is then replaced by the 'm'
+            static constexpr char fg_esc_sequence_start[]  = "\x1b[38;2;";
+            static constexpr char bg_esc_sequence_start[]  = "\x1b[48;2;";
+            static constexpr size_t esc_sequence_start_len = sizeof(fg_esc_sequence_start) - 1;
+            // '▀' in utf-8
+            static constexpr char upper_half_block[]     = "\xe2\x96\x80";
+            static constexpr size_t upper_half_block_len = sizeof(upper_half_block) - 1;
+            // both escape sequences with 3 digits for every channel and the block
+            static constexpr size_t max_cell_len = 2 * (esc_sequence_start_len + 12) + upper_half_block_len;
+
+            std::span<const std::string_view> TranslateFrameBuffer();
+
+        public:
+            // the height of the framebuffer has to be twice the height of the terminal
+            HalfBlockFrameDrawer(std::shared_ptr<FrameBuffer<uint32_t>> framebuffer, std::shared_ptr<ITerminalManager<T>> terminal_manager);
+
+            void SetColorTolerance(uint8_t color_tolerance, bool temporal_color_tolerance);
+
+            virtual void SetupFrameDrawer() override;
+
+            virtual void SetPixel(uint16_t x, uint16_t y, RGBColor color) override;
+
+            virtual void DisplayFrame() override;
+
+            virtual void ClearFrameBuffer() override;
+
+            virtual void ReportInformation(const std::string& info) override;
+
+            [[nodiscard]] virtual uint16_t GetFrameBufferWidth() const override;
+            [[nodiscard]] virtual uint16_t GetFrameBufferHeight() const override;
+        };
+    }
+}
+
+#endif
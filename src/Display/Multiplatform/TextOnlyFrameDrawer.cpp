@@ -34,12 +34,20 @@ namespace Display
             shades_count((uint8_t)shades.length())
         {
             this->framebuffer->FillBuffer(' ');
+
+            diff_encoder = std::make_unique<FrameDiffEncoder<char>>();
+            diff_encoder->Resize(this->framebuffer->GetWidth(), this->framebuffer->GetHeight(), 1);
         }
 
         template<typename T>
         void TextOnlyFrameDrawer<T>::SetupFrameDrawer()
         {
             terminal_manager->SetupTerminalManager();
+
+            if (diff_encoder)
+            {
+                diff_encoder->Invalidate();
+            }
         }
 
         template<>
@@ -62,12 +70,23 @@ namespace Display
             framebuffer->SetValue(x, y, shades[index]);
         }
 
-        template<typename T>
-        void TextOnlyFrameDrawer<T>::DisplayFrame()
+        template<>
+        void TextOnlyFrameDrawer<CHAR_INFO>::DisplayFrame()
         {
             terminal_manager->WriteFrameBufferData(framebuffer->GetFrameBufferData());
         }
 
+        template<>
+        void TextOnlyFrameDrawer<char>::DisplayFrame()
+        {
+            auto encode_cell = [](char*& out, char cell, std::optional<char>&)
+            {
+                *out++ = cell;
+            };
+
+            terminal_manager->WriteStrings(diff_encoder->Encode(framebuffer->GetFrameBufferData(), encode_cell));
+        }
+
         template<typename T>
         void TextOnlyFrameDrawer<T>::ReportInformation(const std::string& info)
         {
@@ -87,13 +106,13 @@ namespace Display
         }
 
         template<typename T>
-        const uint16_t TextOnlyFrameDrawer<T>::GetFrameBufferWidth() const
+        uint16_t TextOnlyFrameDrawer<T>::GetFrameBufferWidth() const
         {
             return framebuffer->GetWidth();
         }
 
         template<typename T>
-        const uint16_t TextOnlyFrameDrawer<T>::GetFrameBufferHeight() const
+        uint16_t TextOnlyFrameDrawer<T>::GetFrameBufferHeight() const
         {
             return framebuffer->GetHeight();
         }
@@ -2,6 +2,7 @@
 #define TEXTONLYFRAMEDRAWER_HPP
 
 #include "Display/FrameBuffer.hpp"
+#include "Display/FrameDiffEncoder.hpp"
 #include "Display/IFrameDrawer.hpp"
 #include "Display/ITerminalManager.hpp"
 #include "Display/RGBColor.hpp"
@@ -24,6 +25,10 @@ namespace Display
             const std::string shades;
             const uint8_t shades_count;
 
+            // the characters are written as escape sequences with only the cells that changed since the last frame, the console api of
+            // CHAR_INFO takes the whole framebuffer so it never gets an encoder
+            std::unique_ptr<FrameDiffEncoder<T>> diff_encoder;
+
         public:
             TextOnlyFrameDrawer(std::shared_ptr<FrameBuffer<T>> framebuffer, std::shared_ptr<ITerminalManager<T>> terminal_manager);
 
@@ -37,8 +42,8 @@ namespace Display
 
             virtual void ReportInformation(const std::string& info) override;
 
-            [[nodiscard]] virtual const uint16_t GetFrameBufferWidth() const override;
-            [[nodiscard]] virtual const uint16_t GetFrameBufferHeight() const override;
+            [[nodiscard]] virtual uint16_t GetFrameBufferWidth() const override;
+            [[nodiscard]] virtual uint16_t GetFrameBufferHeight() const override;
         };
     }
 
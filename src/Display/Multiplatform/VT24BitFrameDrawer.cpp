@@ -1,5 +1,7 @@
 #include "VT24BitFrameDrawer.hpp"
 
+#include <cstring>
+
 #ifdef SYS_WINDOWS
 // Windows.h overrides std::min
 #define NOMINMAX
@@ -12,32 +14,29 @@ namespace Display
 {
     namespace Multiplatform
     {
-        template<>
-        VT24BitFrameDrawer<char>::VT24BitFrameDrawer(std::shared_ptr<FrameBuffer<uint32_t>> framebuffer, std::shared_ptr<ITerminalManager<char>> terminal_manager) :
+        template<typename T>
+        VT24BitFrameDrawer<T>::VT24BitFrameDrawer(std::shared_ptr<FrameBuffer<uint32_t>> framebuffer, std::shared_ptr<ITerminalManager<T>> terminal_manager) :
             framebuffer(std::move(framebuffer)),
             terminal_manager(std::move(terminal_manager))
         {
             this->framebuffer->FillBuffer(0x000000);
 
-            framebuffer_string     = std::string(this->framebuffer->GetWidth() * this->framebuffer->GetHeight() * 20, ' ');
-            framebuffer_string_len = 0;
+            diff_encoder.Resize(this->framebuffer->GetWidth(), this->framebuffer->GetHeight(), max_cell_len);
         }
 
-        template<>
-        VT24BitFrameDrawer<CHAR_INFO>::VT24BitFrameDrawer(std::shared_ptr<FrameBuffer<uint32_t>> framebuffer, std::shared_ptr<ITerminalManager<CHAR_INFO>> terminal_manager) :
-            framebuffer(std::move(framebuffer)),
-            terminal_manager(std::move(terminal_manager))
+        template<typename T>
+        void VT24BitFrameDrawer<T>::SetColorTolerance(uint8_t color_tolerance, bool temporal_color_tolerance)
         {
-            this->framebuffer->FillBuffer(0x000000);
+            this->color_tolerance = {color_tolerance, temporal_color_tolerance};
 
-            framebuffer_string     = std::string(this->framebuffer->GetWidth() * this->framebuffer->GetHeight() * 20, ' ');
-            framebuffer_string_len = 0;
+            diff_encoder.Invalidate();
         }
 
         template<typename T>
         void VT24BitFrameDrawer<T>::SetupFrameDrawer()
         {
             terminal_manager->SetupTerminalManager();
+            diff_encoder.Invalidate();
         }
 
         template<typename T>
@@ -47,65 +46,43 @@ namespace Display
         }
 
         template<typename T>
-        void VT24BitFrameDrawer<T>::TranslateFrameBuffer()
+        std::span<const std::string_view> VT24BitFrameDrawer<T>::TranslateFrameBuffer()
         {
-            uint32_t last_color           = 0x000000;
-            uint64_t current_string_index = 0;
+            ColorTolerance color_tolerance = this->color_tolerance;
 
-            for (uint16_t y = 0; y < framebuffer->GetHeight(); y++)
+            auto encode_cell = [color_tolerance](char*& out, uint32_t current_color, std::optional<uint32_t>& last_color)
             {
-                for (uint16_t x = 0; x < framebuffer->GetWidth(); x++)
+                // always set color on the first pixel, last_color stays the color that was written so the run doesn't drift
+                if (!last_color || !color_tolerance.IsCloseColor(current_color, *last_color))
                 {
-                    uint32_t current_color = framebuffer->GetValue(x, y);
-
-                    // always set color on the first pixel
-                    if (current_color != last_color || (y == 0 && x == 0))
-                    {
-                        RGBColor rgbcurrent_color = RGBColor(current_color);
-
-                        std::string red_string = std::to_string(rgbcurrent_color.r) + ";";
-                        uint8_t red_string_len = (uint8_t)red_string.length();
+                    RGBColor rgbcurrent_color = RGBColor(current_color);
 
-                        std::string green_string = std::to_string(rgbcurrent_color.g) + ";";
-                        uint8_t green_string_len = (uint8_t)green_string.length();
+                    std::memcpy(out, esc_sequence_start, esc_sequence_start_len);
+                    out += esc_sequence_start_len;
 
-                        std::string blue_string = std::to_string(rgbcurrent_color.b);
-                        uint8_t blue_string_len = (uint8_t)blue_string.length();
+                    WriteDecimalByte(out, rgbcurrent_color.r);
+                    WriteDecimalByte(out, rgbcurrent_color.g);
+                    WriteDecimalByte(out, rgbcurrent_color.b);
+                    out[-1] = 'm';
 
-                        esc_sequence_start.copy(framebuffer_string.data() + current_string_index, esc_sequence_start_len, 0);
-                        current_string_index += esc_sequence_start_len;
-
-                        red_string.copy(framebuffer_string.data() + current_string_index, red_string_len, 0);
-                        current_string_index += red_string_len;
-
-                        green_string.copy(framebuffer_string.data() + current_string_index, green_string_len, 0);
-                        current_string_index += green_string_len;
-
-                        blue_string.copy(framebuffer_string.data() + current_string_index, blue_string_len, 0);
-                        current_string_index += blue_string_len;
-
-                        esc_sequence_end.copy(framebuffer_string.data() + current_string_index, esc_sequence_len, 0);
-                        current_string_index += esc_sequence_len;
-
-                        last_color = current_color;
-                    }
-
-                    framebuffer_string.data()[current_string_index++] = ' ';
+                    last_color = current_color;
                 }
 
-                framebuffer_string.data()[current_string_index++] = '\n';
-            }
+                *out++ = ' ';
+            };
 
-            framebuffer_string.data()[current_string_index++] = '\0';
+            auto is_same_cell = [color_tolerance](uint32_t color, uint32_t previous_color)
+            {
+                return color_tolerance.IsSameColor(color, previous_color);
+            };
 
-            framebuffer_string_len = current_string_index;
+            return diff_encoder.Encode(framebuffer->GetFrameBufferData(), encode_cell, is_same_cell);
         }
 
         template<typename T>
         void VT24BitFrameDrawer<T>::DisplayFrame()
         {
-            TranslateFrameBuffer();
-            terminal_manager->WriteSizedString(framebuffer_string, framebuffer_string_len);
+            terminal_manager->WriteStrings(TranslateFrameBuffer());
         }
 
         template<typename T>
@@ -121,16 +98,20 @@ namespace Display
         }
 
         template<typename T>
-        const uint16_t VT24BitFrameDrawer<T>::GetFrameBufferWidth() const
+        uint16_t VT24BitFrameDrawer<T>::GetFrameBufferWidth() const
         {
             return framebuffer->GetWidth();
         }
 
         template<typename T>
-        const uint16_t VT24BitFrameDrawer<T>::GetFrameBufferHeight() const
+        uint16_t VT24BitFrameDrawer<T>::GetFrameBufferHeight() const
         {
             return framebuffer->GetHeight();
         }
+
+        // nothing in the constructors differs between the terminal types, so they are instantiated here instead of being specialized
+        template class VT24BitFrameDrawer<char>;
+        template class VT24BitFrameDrawer<CHAR_INFO>;
     }
 
 }
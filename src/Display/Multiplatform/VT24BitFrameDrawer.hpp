@@ -3,14 +3,19 @@
 #ifndef VT24BITFRAMEDRAWER_HPP
 #define VT24BITFRAMEDRAWER_HPP
 
+#include "Display/ColorTolerance.hpp"
+#include "Display/DecimalBytes.hpp"
 #include "Display/FrameBuffer.hpp"
+#include "Display/FrameDiffEncoder.hpp"
 #include "Display/IFrameDrawer.hpp"
 #include "Display/ITerminalManager.hpp"
 #include "Display/RGBColor.hpp"
 
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 
 namespace Display
 {
@@ -23,19 +28,24 @@ namespace Display
             std::shared_ptr<FrameBuffer<uint32_t>> framebuffer;
             std::shared_ptr<ITerminalManager<T>> terminal_manager;
 
-            std::string framebuffer_string;
-            uint64_t framebuffer_string_len;
+            ColorTolerance color_tolerance;
 
-            const std::string esc_sequence_start = "\x1b[48;2;";
-            const uint8_t esc_sequence_start_len = (uint8_t)esc_sequence_start.length();
-            const std::string esc_sequence_end   = "m";
-            const uint8_t esc_sequence_len       = (uint8_t)esc_sequence_end.length();
+            // only the cells that changed since the last frame are written
+            FrameDiffEncoder<uint32_t> diff_encoder;
 
-            void TranslateFrameBuffer();
+            // the last parameter is written with its ';' which is then replaced by the 'm'
+            static constexpr char esc_sequence_start[]     = "\x1b[48;2;";
+            static constexpr size_t esc_sequence_start_len = sizeof(esc_sequence_start) - 1;
+            // the escape sequence with 3 digits for every channel and the space
+            static constexpr size_t max_cell_len = 20;
+
+            std::span<const std::string_view> TranslateFrameBuffer();
 
         public:
             VT24BitFrameDrawer(std::shared_ptr<FrameBuffer<uint32_t>> framebuffer, std::shared_ptr<ITerminalManager<T>> terminal_manager);
 
+            void SetColorTolerance(uint8_t color_tolerance, bool temporal_color_tolerance);
+
             virtual void SetupFrameDrawer() override;
 
             virtual void SetPixel(uint16_t x, uint16_t y, RGBColor color) override;
@@ -46,8 +56,8 @@ namespace Display
 
             virtual void ReportInformation(const std::string& info) override;
 
-            [[nodiscard]] virtual const uint16_t GetFrameBufferWidth() const override;
-            [[nodiscard]] virtual const uint16_t GetFrameBufferHeight() const override;
+            [[nodiscard]] virtual uint16_t GetFrameBufferWidth() const override;
+            [[nodiscard]] virtual uint16_t GetFrameBufferHeight() const override;
         };
     }
 }
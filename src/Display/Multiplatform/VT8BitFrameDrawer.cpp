@@ -2,6 +2,8 @@
 
 #include "Display/ColorMapping.hpp"
 
+#include <cstring>
+
 #ifdef SYS_WINDOWS
 // Windows.h overrides std::min
 #define NOMINMAX
@@ -21,8 +23,7 @@ namespace Display
         {
             this->framebuffer->FillBuffer(0x000000);
 
-            framebuffer_string     = std::string(this->framebuffer->GetWidth() * this->framebuffer->GetHeight() * 20, ' ');
-            framebuffer_string_len = 0;
+            diff_encoder.Resize(this->framebuffer->GetWidth(), this->framebuffer->GetHeight(), max_cell_len);
         }
 
         template<>
@@ -32,14 +33,14 @@ namespace Display
         {
             this->framebuffer->FillBuffer(0x000000);
 
-            framebuffer_string     = std::string(this->framebuffer->GetWidth() * this->framebuffer->GetHeight() * 20, ' ');
-            framebuffer_string_len = 0;
+            diff_encoder.Resize(this->framebuffer->GetWidth(), this->framebuffer->GetHeight(), max_cell_len);
         }
 
         template<typename T>
         void VT8BitFrameDrawer<T>::SetupFrameDrawer()
         {
             terminal_manager->SetupTerminalManager();
+            diff_encoder.Invalidate();
         }
 
         template<typename T>
@@ -51,51 +52,32 @@ namespace Display
         }
 
         template<typename T>
-        void VT8BitFrameDrawer<T>::TranslateFrameBuffer()
+        std::span<const std::string_view> VT8BitFrameDrawer<T>::TranslateFrameBuffer()
         {
-            uint8_t last_color            = 0x000000;
-            uint64_t current_string_index = 0;
-
-            for (uint16_t y = 0; y < framebuffer->GetHeight(); y++)
+            auto encode_cell = [](char*& out, uint8_t current_color, std::optional<uint8_t>& last_color)
             {
-                for (uint16_t x = 0; x < framebuffer->GetWidth(); x++)
+                // always set color on the first pixel
+                if (current_color != last_color)
                 {
-                    uint8_t current_color = framebuffer->GetValue(x, y);
-
-                    // always set color on the first pixel
-                    if (current_color != last_color || (y == 0 && x == 0))
-                    {
-                        std::string index_str = std::to_string(current_color);
-                        uint8_t index_str_len = (uint8_t)index_str.length();
-
-                        esc_sequence_start.copy(framebuffer_string.data() + current_string_index, esc_sequence_start_len, 0);
-                        current_string_index += esc_sequence_start_len;
+                    std::memcpy(out, esc_sequence_start, esc_sequence_start_len);
+                    out += esc_sequence_start_len;
 
-                        index_str.copy(framebuffer_string.data() + current_string_index, index_str_len, 0);
-                        current_string_index += index_str_len;
+                    WriteDecimalByte(out, current_color);
+                    out[-1] = 'm';
 
-                        esc_sequence_end.copy(framebuffer_string.data() + current_string_index, esc_sequence_len, 0);
-                        current_string_index += esc_sequence_len;
-
-                        last_color = current_color;
-                    }
-
-                    framebuffer_string.data()[current_string_index++] = ' ';
+                    last_color = current_color;
                 }
 
-                framebuffer_string.data()[current_string_index++] = '\n';
-            }
-
-            framebuffer_string.data()[current_string_index++] = '\0';
+                *out++ = ' ';
+            };
 
-            framebuffer_string_len = current_string_index;
+            return diff_encoder.Encode(framebuffer->GetFrameBufferData(), encode_cell);
         }
 
         template<typename T>
         void VT8BitFrameDrawer<T>::DisplayFrame()
         {
-            TranslateFrameBuffer();
-            terminal_manager->WriteSizedString(framebuffer_string, framebuffer_string_len);
+            terminal_manager->WriteStrings(TranslateFrameBuffer());
         }
 
         template<typename T>
@@ -111,13 +93,13 @@ namespace Display
         }
 
         template<typename T>
-        const uint16_t VT8BitFrameDrawer<T>::GetFrameBufferWidth() const
+        uint16_t VT8BitFrameDrawer<T>::GetFrameBufferWidth() const
         {
             return framebuffer->GetWidth();
         }
 
         template<typename T>
-        const uint16_t VT8BitFrameDrawer<T>::GetFrameBufferHeight() const
+        uint16_t VT8BitFrameDrawer<T>::GetFrameBufferHeight() const
         {
             return framebuffer->GetHeight();
         }
@@ -3,7 +3,9 @@
 #ifndef VT8BITFRAMEDRAWER_HPP
 #define VT8BITFRAMEDRAWER_HPP
 
+#include "Display/DecimalBytes.hpp"
 #include "Display/FrameBuffer.hpp"
+#include "Display/FrameDiffEncoder.hpp"
 #include "Display/IFrameDrawer.hpp"
 #include "Display/ITerminalManager.hpp"
 #include "Display/RGBColor.hpp"
@@ -11,7 +13,9 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 
 namespace Display
 {
@@ -77,15 +81,16 @@ namespace Display
             std::shared_ptr<FrameBuffer<uint8_t>> framebuffer;
             std::shared_ptr<ITerminalManager<T>> terminal_manager;
 
-            std::string framebuffer_string;
-            uint64_t framebuffer_string_len;
+            // only the cells that changed since the last frame are written
+            FrameDiffEncoder<uint8_t> diff_encoder;
 
-            const std::string esc_sequence_start = "\x1b[48;5;";
-            const uint8_t esc_sequence_start_len = (uint8_t)esc_sequence_start.length();
-            const std::string esc_sequence_end   = "m";
-            const uint8_t esc_sequence_len       = (uint8_t)esc_sequence_end.length();
+            // the last parameter is written with its ';' which is then replaced by the 'm'
+            static constexpr char esc_sequence_start[]     = "\x1b[48;5;";
+            static constexpr size_t esc_sequence_start_len = sizeof(esc_sequence_start) - 1;
+            // the escape sequence with a 3 digit index and the space
+            static constexpr size_t max_cell_len = 12;
 
-            void TranslateFrameBuffer();
+            std::span<const std::string_view> TranslateFrameBuffer();
 
         public:
             VT8BitFrameDrawer(std::shared_ptr<FrameBuffer<uint8_t>> framebuffer, std::shared_ptr<ITerminalManager<T>> terminal_manager);
@@ -100,8 +105,8 @@ namespace Display
 
             virtual void ReportInformation(const std::string& info) override;
 
-            [[nodiscard]] virtual const uint16_t GetFrameBufferWidth() const override;
-            [[nodiscard]] virtual const uint16_t GetFrameBufferHeight() const override;
+            [[nodiscard]] virtual uint16_t GetFrameBufferWidth() const override;
+            [[nodiscard]] virtual uint16_t GetFrameBufferHeight() const override;
         };
     }
 }
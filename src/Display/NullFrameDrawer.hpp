@@ -38,12 +38,12 @@ namespace Display
         {
         }
 
-        [[nodiscard]] virtual const uint16_t GetFrameBufferWidth() const override
+        [[nodiscard]] virtual uint16_t GetFrameBufferWidth() const override
         {
             return 200;    // todo make this changable
         }
 
-        [[nodiscard]] virtual const uint16_t GetFrameBufferHeight() const override
+        [[nodiscard]] virtual uint16_t GetFrameBufferHeight() const override
         {
             return 200;
         }
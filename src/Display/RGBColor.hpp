@@ -54,6 +54,19 @@ namespace Display
             return 0.3f * (color >> 16) + 0.59f * (color >> 8 & 0xFF) + 0.11f * (color & 0xFF);
         }
 
+        /**
+         * Returns whether two colors look about the same, the channels are weighted 2, 4 and 3 for how well the eye tells them apart so a
+         * tolerance of n allows an average difference of n per channel
+         */
+        [[nodiscard]] static inline constexpr bool IsHexWithinTolerance(uint32_t color, uint32_t other, uint8_t tolerance)
+        {
+            int32_t red_diff   = (int32_t)(color >> 16) - (int32_t)(other >> 16);
+            int32_t green_diff = (int32_t)(color >> 8 & 0xFF) - (int32_t)(other >> 8 & 0xFF);
+            int32_t blue_diff  = (int32_t)(color & 0xFF) - (int32_t)(other & 0xFF);
+
+            return 2 * red_diff * red_diff + 4 * green_diff * green_diff + 3 * blue_diff * blue_diff <= 9 * tolerance * tolerance;
+        }
+
         // avoids converting to HSV to get the value
         [[nodiscard]] inline constexpr float GetColorNormal() const
         {
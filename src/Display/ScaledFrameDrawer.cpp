@@ -0,0 +1,106 @@
+#include "ScaledFrameDrawer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Display
+{
+    ScaledFrameDrawer::ScaledFrameDrawer(std::shared_ptr<IFrameDrawer> target_frame_drawer) : target_frame_drawer(std::move(target_frame_drawer)), scale(0.0f), is_scaled(false)
+    {
+        SetScale(1.0f);
+    }
+
+    void ScaledFrameDrawer::SetScale(float scale)
+    {
+        if (scale == this->scale)
+            return;
+
+        this->scale = scale;
+
+        uint16_t target_width  = target_frame_drawer->GetFrameBufferWidth();
+        uint16_t target_height = target_frame_drawer->GetFrameBufferHeight();
+
+        uint16_t width  = (uint16_t)std::max(1.0f, std::round(target_width * scale));
+        uint16_t height = (uint16_t)std::max(1.0f, std::round(target_height * scale));
+
+        framebuffer = FrameBuffer<uint32_t>(width, height);
+        is_scaled   = width != target_width || height != target_height;
+
+        source_columns.resize(target_width);
+        source_rows.resize(target_height);
+
+        for (uint16_t x = 0; x < target_width; x++)
+            source_columns[x] = (uint16_t)((uint32_t)x * width / target_width);
+
+        for (uint16_t y = 0; y < target_height; y++)
+            source_rows[y] = (uint16_t)((uint32_t)y * height / target_height);
+    }
+
+    float ScaledFrameDrawer::GetScale() const
+    {
+        return scale;
+    }
+
+    void ScaledFrameDrawer::SetupFrameDrawer()
+    {
+        target_frame_drawer->SetupFrameDrawer();
+    }
+
+    void ScaledFrameDrawer::SetPixel(uint16_t x, uint16_t y, RGBColor color)
+    {
+        if (!is_scaled)
+        {
+            target_frame_drawer->SetPixel(x, y, color);
+            return;
+        }
+
+        framebuffer.SetValue(x, y, color.GetHexValues());
+    }
+
+    void ScaledFrameDrawer::DisplayFrame()
+    {
+        if (is_scaled)
+        {
+            // nearest neighbour, every pixel of the target is written so it doesn't need to be cleared
+            for (uint16_t y = 0; y < source_rows.size(); y++)
+            {
+                for (uint16_t x = 0; x < source_columns.size(); x++)
+                    target_frame_drawer->SetPixel(x, y, RGBColor(framebuffer.GetValue(source_columns[x], source_rows[y])));
+            }
+        }
+
+        target_frame_drawer->DisplayFrame();
+    }
+
+    void ScaledFrameDrawer::ClearFrameBuffer()
+    {
+        if (!is_scaled)
+        {
+            target_frame_drawer->ClearFrameBuffer();
+            return;
+        }
+
+        framebuffer.FillBuffer(0x000000);
+    }
+
+    void ScaledFrameDrawer::ReportInformation(const std::string& info)
+    {
+        if (!is_scaled)
+        {
+            target_frame_drawer->ReportInformation(info);
+            return;
+        }
+
+        target_frame_drawer->ReportInformation(info + " | " + std::to_string(framebuffer.GetWidth()) + "x" + std::to_string(framebuffer.GetHeight()));
+    }
+
+    uint16_t ScaledFrameDrawer::GetFrameBufferWidth() const
+    {
+        return framebuffer.GetWidth();
+    }
+
+    uint16_t ScaledFrameDrawer::GetFrameBufferHeight() const
+    {
+        return framebuffer.GetHeight();
+    }
+}
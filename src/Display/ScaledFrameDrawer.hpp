@@ -0,0 +1,54 @@
+#ifndef SCALEDFRAMEDRAWER_HPP
+#define SCALEDFRAMEDRAWER_HPP
+
+#include "FrameBuffer.hpp"
+#include "IFrameDrawer.hpp"
+#include "RGBColor.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Display
+{
+    // renders at a fraction of the resolution of another frame drawer and upscales into it when the frame is displayed, so the render resolution
+    // can drop when frames are too slow without changing the terminal, at a scale of 1 everything goes straight through
+    class ScaledFrameDrawer : public IFrameDrawer
+    {
+    private:
+        std::shared_ptr<IFrameDrawer> target_frame_drawer;
+
+        float scale;
+        // false when the scale rounds to the target's size
+        bool is_scaled;
+        FrameBuffer<uint32_t> framebuffer;
+
+        // the pixel of the framebuffer each column and row of the target is upscaled from
+        std::vector<uint16_t> source_columns;
+        std::vector<uint16_t> source_rows;
+
+    public:
+        ScaledFrameDrawer(std::shared_ptr<IFrameDrawer> target_frame_drawer);
+
+        // the fraction of the target's width and height that is rendered, the renderers have to be given the frame drawer again after it changes
+        // since the size does
+        void SetScale(float scale);
+        [[nodiscard]] float GetScale() const;
+
+        virtual void SetupFrameDrawer() override;
+
+        virtual void SetPixel(uint16_t x, uint16_t y, RGBColor color) override;
+
+        virtual void DisplayFrame() override;
+
+        virtual void ClearFrameBuffer() override;
+
+        virtual void ReportInformation(const std::string& info) override;
+
+        [[nodiscard]] virtual uint16_t GetFrameBufferWidth() const override;
+        [[nodiscard]] virtual uint16_t GetFrameBufferHeight() const override;
+    };
+}
+
+#endif
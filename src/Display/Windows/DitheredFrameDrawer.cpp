@@ -45,12 +45,12 @@ namespace Display
             this->framebuffer->FillBuffer({{' '}, 0x00});
         }
 
-        const uint16_t DitheredFrameDrawer::GetFrameBufferWidth() const
+        uint16_t DitheredFrameDrawer::GetFrameBufferWidth() const
         {
             return framebuffer->GetWidth();
         }
 
-        const uint16_t DitheredFrameDrawer::GetFrameBufferHeight() const
+        uint16_t DitheredFrameDrawer::GetFrameBufferHeight() const
         {
             return framebuffer->GetHeight();
         }
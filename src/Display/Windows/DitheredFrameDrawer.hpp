@@ -173,8 +173,8 @@ namespace Display
 
             virtual void ReportInformation(const std::string& info) override;
 
-            [[nodiscard]] virtual const uint16_t GetFrameBufferWidth() const override;
-            [[nodiscard]] virtual const uint16_t GetFrameBufferHeight() const override;
+            [[nodiscard]] virtual uint16_t GetFrameBufferWidth() const override;
+            [[nodiscard]] virtual uint16_t GetFrameBufferHeight() const override;
         };
     }
 }
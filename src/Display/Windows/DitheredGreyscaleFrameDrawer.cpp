@@ -111,12 +111,12 @@ namespace Display
             this->framebuffer->FillBuffer({{' '}, 0x00});
         }
 
-        const uint16_t DitheredGreyscaleFrameDrawer::GetFrameBufferWidth() const
+        uint16_t DitheredGreyscaleFrameDrawer::GetFrameBufferWidth() const
         {
             return framebuffer->GetWidth();
         }
 
-        const uint16_t DitheredGreyscaleFrameDrawer::GetFrameBufferHeight() const
+        uint16_t DitheredGreyscaleFrameDrawer::GetFrameBufferHeight() const
         {
             return framebuffer->GetHeight();
         }
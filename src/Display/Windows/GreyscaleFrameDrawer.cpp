@@ -46,12 +46,12 @@ namespace Display
             this->framebuffer->FillBuffer({{' '}, 0x00});
         }
 
-        const uint16_t GreyscaleFrameDrawer::GetFrameBufferWidth() const
+        uint16_t GreyscaleFrameDrawer::GetFrameBufferWidth() const
         {
             return framebuffer->GetWidth();
         }
 
-        const uint16_t GreyscaleFrameDrawer::GetFrameBufferHeight() const
+        uint16_t GreyscaleFrameDrawer::GetFrameBufferHeight() const
         {
             return framebuffer->GetHeight();
         }
@@ -158,13 +158,14 @@ namespace Display
                                 &writeregion);          // region to write to
         }
 
-        void WindowsTerminalManager::WriteSizedString(const std::string& string, uint64_t size)
+        void WindowsTerminalManager::WriteStrings(std::span<const std::string_view> strings)
         {
             DWORD written_count;
 
             SetConsoleCursorPosition(consolescreenbuffer, {0, 0});
 
-            WriteFile(consolescreenbuffer, string.c_str(), (DWORD)size, &written_count, nullptr);
+            for (std::string_view string : strings)
+                WriteFile(consolescreenbuffer, string.data(), (DWORD)string.size(), &written_count, nullptr);
         }
     }
 }
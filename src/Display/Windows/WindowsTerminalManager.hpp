@@ -74,7 +74,7 @@ namespace Display
             virtual void EnableCursor() override;
 
             virtual void WriteFrameBufferData(const CHAR_INFO* data) override;
-            virtual void WriteSizedString(const std::string& string, uint64_t size) override;
+            virtual void WriteStrings(std::span<const std::string_view> strings) override;
         };
     }
 }
@@ -0,0 +1,98 @@
+#include "WorkerPool.hpp"
+
+#include <algorithm>
+
+namespace Display
+{
+    WorkerPool::WorkerPool(uint16_t worker_count)
+    {
+        for (uint16_t i = 0; i < worker_count; i++)
+            threads.emplace_back(&WorkerPool::WorkerLoop, this);
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+
+        job_ready.notify_all();
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    void WorkerPool::RunTasks()
+    {
+        for (uint16_t i = next_task++; i < task_count; i = next_task++)
+            (*task)(i);
+    }
+
+    void WorkerPool::WorkerLoop()
+    {
+        uint64_t last_job = 0;
+
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (true)
+        {
+            job_ready.wait(lock, [&]() { return stopping || job_counter != last_job; });
+
+            if (stopping)
+                return;
+
+            last_job = job_counter;
+
+            lock.unlock();
+            RunTasks();
+            lock.lock();
+
+            if (--busy_workers == 0)
+                job_done.notify_one();
+        }
+    }
+
+    uint16_t WorkerPool::GetThreadCount() const
+    {
+        return (uint16_t)threads.size() + 1;
+    }
+
+    void WorkerPool::Run(uint16_t task_count, const std::function<void(uint16_t)>& task)
+    {
+        if (threads.empty() || task_count <= 1)
+        {
+            for (uint16_t i = 0; i < task_count; i++)
+                task(i);
+
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            this->task       = &task;
+            this->task_count = task_count;
+            next_task        = 0;
+            busy_workers     = (uint16_t)threads.size();
+            job_counter++;
+        }
+
+        job_ready.notify_all();
+
+        RunTasks();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        job_done.wait(lock, [&]() { return busy_workers == 0; });
+    }
+
+    WorkerPool& GetFrameEncodeWorkerPool()
+    {
+        // hardware_concurrency can be 0 when it isn't known, the encoding doesn't gain from many more threads than this
+        static constexpr uint16_t max_worker_count = 7;
+
+        static WorkerPool worker_pool(std::min<uint16_t>(max_worker_count, (uint16_t)std::max(1u, std::thread::hardware_concurrency()) - 1));
+
+        return worker_pool;
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef WORKERPOOL_HPP
+#define WORKERPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Display
+{
+    // runs the tasks of a job on worker threads and the calling thread, the threads wait between jobs instead of being started for every one
+    class WorkerPool
+    {
+    private:
+        std::vector<std::thread> threads;
+
+        std::mutex mutex;
+        std::condition_variable job_ready;
+        std::condition_variable job_done;
+
+        // the job, read by the workers after the job counter changes
+        const std::function<void(uint16_t)>* task = nullptr;
+        uint16_t task_count                       = 0;
+        std::atomic<uint16_t> next_task           = 0;
+        uint16_t busy_workers                     = 0;
+        uint64_t job_counter                      = 0;
+        bool stopping                             = false;
+
+        void RunTasks();
+        void WorkerLoop();
+
+    public:
+        explicit WorkerPool(uint16_t worker_count);
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&)            = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        // the workers and the calling thread
+        [[nodiscard]] uint16_t GetThreadCount() const;
+
+        // calls task with every index below task_count and returns once they all returned
+        void Run(uint16_t task_count, const std::function<void(uint16_t)>& task);
+    };
+
+    // the pool the frame drawers encode their frames on, a worker for every hardware thread but the one drawing
+    [[nodiscard]] WorkerPool& GetFrameEncodeWorkerPool();
+}
+
+#endif
@@ -1,5 +1,10 @@
 #include "Consol3Engine.hpp"
 
+#include "Engine/Kernels/KernelRegistry.hpp"
+
+#include <algorithm>
+#include <thread>
+
 #define UPDATE_STEP 10
 
 namespace Engine
@@ -12,6 +17,7 @@ namespace Engine
 
     Consol3Engine::Consol3Engine(std::shared_ptr<IGame> game, std::shared_ptr<IInputManager> input_manager) : game(std::move(game)), running(false), delta(0), input_manager(input_manager)
     {
+        quality_governor.SetTierCount((uint8_t)this->game->GetQualityTiers().size());
     }
 
     void Consol3Engine::HandleFrameDrawerChangeInput()
@@ -20,8 +26,10 @@ namespace Engine
         {
             cur_frame_drawer_index = (cur_frame_drawer_index + 1) % frame_drawers.size();
 
+            frame_drawers[cur_frame_drawer_index]->SetScale(quality_governor.GetResolutionScale());
             game->SetFrameDrawer(frame_drawers[cur_frame_drawer_index]);
             changed_frame_drawer = true;
+            frame_outdated       = true;
         }
         if (input_manager->IsKeyHeld(Key::PAGE_DOWN) && !changed_frame_drawer)
         {
@@ -29,8 +37,10 @@ namespace Engine
             if (cur_frame_drawer_index < 0)
                 cur_frame_drawer_index = static_cast<int8_t>(frame_drawers.size() - 1);
 
+            frame_drawers[cur_frame_drawer_index]->SetScale(quality_governor.GetResolutionScale());
             game->SetFrameDrawer(frame_drawers[cur_frame_drawer_index]);
             changed_frame_drawer = true;
+            frame_outdated       = true;
         }
 
         if (input_manager->IsKeyReleased(Key::PAGE_UP) && input_manager->IsKeyReleased(Key::PAGE_DOWN))
@@ -39,13 +49,18 @@ namespace Engine
 
     void Consol3Engine::RegisterFrameDrawer(std::shared_ptr<IFrameDrawer> frame_drawer)
     {
-        frame_drawers.push_back(std::move(frame_drawer));
+        frame_drawers.push_back(std::make_shared<ScaledFrameDrawer>(std::move(frame_drawer)));
 
         // if its the first registered frame drawer, assing it to the game
         if (frame_drawers.size() == 1)
             game->SetFrameDrawer(frame_drawers[0]);
     }
 
+    void Consol3Engine::SetFrameTimeBudget(int64_t frame_time_budget)
+    {
+        quality_governor.SetFrameTimeBudget(frame_time_budget);
+    }
+
     inline int64_t Consol3Engine::GetCurrentTime() const
     {
         high_resolution_clock::time_point now_time = high_resolution_clock::now();
@@ -98,7 +113,14 @@ namespace Engine
             if (accumulated_delta > 1000)
             {
                 // frame_drawer->ReportInformation(std::string("Consol3 - FPS: ") + std::to_string(frame_count));
-                frame_drawers[cur_frame_drawer_index]->ReportInformation("Consol3 | " + game->GetDesiredWindowTitle() + " | FPS: " + std::to_string(frame_count));
+                // the instruction set the kernels run with, to tell apart benchmarks with a forced one
+                std::string isa_level = Kernels::GetISALevelName(Kernels::GetKernelRegistry().GetActiveISALevel());
+                std::string title     = "Consol3 | " + game->GetDesiredWindowTitle() + " | FPS: " + std::to_string(frame_count) + " | " + isa_level;
+
+                if (quality_governor.GetQualityLevel() > 0)
+                    title += " | without " + GetGivenUpTiers();
+
+                frame_drawers[cur_frame_drawer_index]->ReportInformation(title);
 
                 frame_count       = 0;
                 accumulated_delta = 0;
@@ -115,8 +137,28 @@ namespace Engine
                 accumulator -= UPDATE_STEP;
             }
 
-            DrawFrame(delta);
-            frame_count++;
+            uint64_t scene_hash = game->GetSceneHash();
+
+            if (frame_outdated || scene_hash != drawn_scene_hash)
+            {
+                drawn_scene_hash = scene_hash;
+                frame_outdated   = false;
+
+                DrawFrame(delta);
+
+                if (!skipped_frame)
+                    UpdateQuality(delta);
+
+                skipped_frame = false;
+                frame_count++;
+            }
+            else
+            {
+                // nothing would change on screen, so wait for the next update instead of drawing the same frame again
+                std::this_thread::sleep_for(milliseconds(UPDATE_STEP));
+                skipped_frame = true;
+            }
+
             last_time = current_time;
         }
     }
@@ -128,4 +170,32 @@ namespace Engine
         game->Render(delta);
         frame_drawers[cur_frame_drawer_index]->DisplayFrame();
     }
+
+    void Consol3Engine::UpdateQuality(int64_t delta)
+    {
+        float old_scale = quality_governor.GetResolutionScale();
+
+        if (!quality_governor.Update(delta))
+            return;
+
+        game->SetQualityLevel(quality_governor.GetQualityLevel());
+        frame_outdated = true;
+
+        if (quality_governor.GetResolutionScale() == old_scale)
+            return;
+
+        // the game recreates its camera and renderers for the new size
+        frame_drawers[cur_frame_drawer_index]->SetScale(quality_governor.GetResolutionScale());
+        game->SetFrameDrawer(frame_drawers[cur_frame_drawer_index]);
+    }
+
+    std::string Consol3Engine::GetGivenUpTiers() const
+    {
+        std::string given_up_tiers;
+
+        for (uint8_t i = 0; i < quality_governor.GetQualityLevel(); i++)
+            given_up_tiers += (i == 0 ? "" : ", ") + std::string(game->GetQualityTiers()[i].name);
+
+        return given_up_tiers;
+    }
 }
@@ -3,13 +3,16 @@
 
 #include "Display/FrameBuffer.hpp"
 #include "Display/IFrameDrawer.hpp"
+#include "Display/ScaledFrameDrawer.hpp"
 #include "Engine/Rendering/RasterSceneRenderer.hpp"
 #include "Game/IGame.hpp"
 #include "Input/IInputManager.hpp"
+#include "QualityGovernor.hpp"
 
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace Engine
@@ -24,9 +27,13 @@ namespace Engine
     class Consol3Engine
     {
     private:
-        std::vector<std::shared_ptr<IFrameDrawer>> frame_drawers;
+        // the registered frame drawers are wrapped so the game can render at a lower resolution than the terminal's
+        std::vector<std::shared_ptr<ScaledFrameDrawer>> frame_drawers;
         int8_t cur_frame_drawer_index = 0;
 
+        // lowers the game's quality tiers and then the render resolution when the frames take longer than the budget
+        QualityGovernor quality_governor;
+
         std::shared_ptr<IInputManager> input_manager;
 
         std::shared_ptr<IGame> game;
@@ -35,17 +42,29 @@ namespace Engine
         float delta;
         bool changed_frame_drawer = false;
 
+        // the scene hash of the game in the last drawn frame, a frame is only drawn when it changed or the frame is outdated because the frame
+        // drawer or the quality changed
+        uint64_t drawn_scene_hash = 0;
+        bool frame_outdated       = true;
+        // the delta after a skipped frame includes the wait, so it's left out of the frame times
+        bool skipped_frame = false;
+
         high_resolution_clock::time_point start_time;
 
         int64_t GetCurrentTime() const;
 
         void RunLoop();
         inline void DrawFrame(int64_t delta);
+        void UpdateQuality(int64_t delta);
+        // the names of the quality tiers that are given up, for the title
+        [[nodiscard]] std::string GetGivenUpTiers() const;
 
     public:
         Consol3Engine(std::shared_ptr<IGame> game, std::shared_ptr<IInputManager> input_manager);
 
         void RegisterFrameDrawer(std::shared_ptr<IFrameDrawer> frame_drawer);
+        // in milliseconds
+        void SetFrameTimeBudget(int64_t frame_time_budget);
 
         void HandleFrameDrawerChangeInput();
 
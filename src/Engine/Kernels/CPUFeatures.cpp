@@ -0,0 +1,87 @@
+#include "CPUFeatures.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+#if defined(KERNELS_X86) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace Engine
+{
+    namespace Kernels
+    {
+        static constexpr const char* isa_level_names[isa_level_count] = {"scalar", "sse4.1", "avx2", "avx512"};
+
+        ISALevel DetectISALevel()
+        {
+#if defined(KERNELS_X86) && (defined(__GNUC__) || defined(__clang__))
+            // also checks that the OS saves the AVX registers
+            __builtin_cpu_init();
+
+            if (__builtin_cpu_supports("avx512f"))
+                return ISALevel::AVX512;
+            if (__builtin_cpu_supports("avx2"))
+                return ISALevel::AVX2;
+            if (__builtin_cpu_supports("sse4.1"))
+                return ISALevel::SSE4_1;
+#elif defined(KERNELS_X86) && defined(_MSC_VER)
+            int cpu_info[4];
+
+            __cpuid(cpu_info, 0);
+            int max_leaf = cpu_info[0];
+
+            __cpuid(cpu_info, 1);
+            bool has_sse4_1  = (cpu_info[2] & (1 << 19)) != 0;
+            bool has_osxsave = (cpu_info[2] & (1 << 27)) != 0;
+
+            // the bits of XCR0 for the SSE, AVX and AVX-512 state
+            uint64_t os_saved_state = has_osxsave ? _xgetbv(0) : 0;
+            bool os_saves_avx       = (os_saved_state & 0x06) == 0x06;
+            bool os_saves_avx512    = (os_saved_state & 0xE6) == 0xE6;
+
+            bool has_avx2    = false;
+            bool has_avx512f = false;
+
+            if (max_leaf >= 7)
+            {
+                __cpuidex(cpu_info, 7, 0);
+                has_avx2    = (cpu_info[1] & (1 << 5)) != 0;
+                has_avx512f = (cpu_info[1] & (1 << 16)) != 0;
+            }
+
+            if (has_avx512f && os_saves_avx512)
+                return ISALevel::AVX512;
+            if (has_avx2 && os_saves_avx)
+                return ISALevel::AVX2;
+            if (has_sse4_1)
+                return ISALevel::SSE4_1;
+#endif
+
+            return ISALevel::SCALAR;
+        }
+
+        const char* GetISALevelName(ISALevel level)
+        {
+            return isa_level_names[(uint8_t)level];
+        }
+
+        bool ParseISALevel(const std::string& name, ISALevel& out_level)
+        {
+            std::string lower_name = name;
+            std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+
+            for (uint8_t i = 0; i < isa_level_count; i++)
+            {
+                if (lower_name == isa_level_names[i])
+                {
+                    out_level = (ISALevel)i;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef CPUFEATURES_HPP
+#define CPUFEATURES_HPP
+
+#include <cstdint>
+#include <string>
+
+// the kernels for each instruction set are built with target attributes instead of for the whole program, so one binary can run them where they're
+// supported
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define KERNELS_X86
+#endif
+
+#if defined(KERNELS_X86) && (defined(__GNUC__) || defined(__clang__))
+#define KERNEL_TARGET(isa) __attribute__((target(isa)))
+#else
+#define KERNEL_TARGET(isa)
+#endif
+
+namespace Engine
+{
+    namespace Kernels
+    {
+        // in order, a level can run the kernels of the ones before it
+        enum class ISALevel : uint8_t
+        {
+            SCALAR,
+            SSE4_1,
+            AVX2,
+            AVX512,
+        };
+
+        static constexpr uint8_t isa_level_count = 4;
+
+        // the best level the cpu and the OS (for saving the wider registers) support
+        [[nodiscard]] ISALevel DetectISALevel();
+
+        [[nodiscard]] const char* GetISALevelName(ISALevel level);
+        // the names from GetISALevelName in any case, false if it isn't one
+        [[nodiscard]] bool ParseISALevel(const std::string& name, ISALevel& out_level);
+    }
+}
+
+#endif
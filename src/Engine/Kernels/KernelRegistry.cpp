@@ -0,0 +1,79 @@
+#include "KernelRegistry.hpp"
+
+#include "RasterKernels.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace Engine
+{
+    namespace Kernels
+    {
+        KernelRegistry::KernelRegistry() : detected_level(DetectISALevel()), active_level(detected_level)
+        {
+            RegisterRasterKernels(*this);
+        }
+
+        void KernelRegistry::SetISALevel(ISALevel level)
+        {
+            active_level = std::min(level, detected_level);
+
+            for (KernelEntry& kernel : kernels)
+                kernel.bound_level = kernel.bind(active_level);
+        }
+
+        ISALevel KernelRegistry::GetDetectedISALevel() const
+        {
+            return detected_level;
+        }
+
+        ISALevel KernelRegistry::GetActiveISALevel() const
+        {
+            return active_level;
+        }
+
+        std::string KernelRegistry::GetBindingsReport() const
+        {
+            std::string report;
+
+            for (const KernelEntry& kernel : kernels)
+                report += kernel.name + ": " + GetISALevelName(kernel.bound_level) + "\n";
+
+            return report;
+        }
+
+        KernelRegistry& GetKernelRegistry()
+        {
+            static KernelRegistry kernel_registry;
+
+            return kernel_registry;
+        }
+
+        bool GetRequestedISALevel(int argc, char* argv[], ISALevel& out_level)
+        {
+            static constexpr const char* isa_argument = "--isa=";
+
+            const char* requested_name = std::getenv("CONSOL3_ISA");
+
+            // the argument wins over the environment
+            for (int i = 1; i < argc; i++)
+            {
+                if (std::strncmp(argv[i], isa_argument, std::strlen(isa_argument)) == 0)
+                    requested_name = argv[i] + std::strlen(isa_argument);
+            }
+
+            if (requested_name == nullptr)
+                return false;
+
+            if (!ParseISALevel(requested_name, out_level))
+            {
+                std::cerr << "Unknown instruction set level \"" << requested_name << "\", expected scalar, sse4.1, avx2 or avx512\n";
+                return false;
+            }
+
+            return true;
+        }
+    }
+}
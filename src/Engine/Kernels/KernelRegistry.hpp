@@ -0,0 +1,78 @@
+#ifndef KERNELREGISTRY_HPP
+#define KERNELREGISTRY_HPP
+
+#include "CPUFeatures.hpp"
+
+#include <array>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Engine
+{
+    namespace Kernels
+    {
+        // the hot loops with a version per instruction set, each kernel is a function pointer the code calls through, bound once at startup to the
+        // best version the level allows
+        class KernelRegistry
+        {
+        private:
+            struct KernelEntry
+            {
+                std::string name;
+                // binds the best version up to the level and returns the level of the one it bound
+                std::function<ISALevel(ISALevel)> bind;
+                ISALevel bound_level;
+            };
+
+            std::vector<KernelEntry> kernels;
+
+            ISALevel detected_level;
+            ISALevel active_level;
+
+        public:
+            KernelRegistry();
+
+            // the versions are indexed by ISALevel, the missing ones null, the scalar one is required and the pointer starts out bound to it
+            template<typename F>
+            void Register(const std::string& name, F& kernel, const std::array<F, isa_level_count>& versions)
+            {
+                kernel = versions[0];
+
+                std::function<ISALevel(ISALevel)> bind = [&kernel, versions](ISALevel max_level) {
+                    for (int8_t level = (int8_t)max_level; level > 0; level--)
+                    {
+                        if (versions[level] != nullptr)
+                        {
+                            kernel = versions[level];
+                            return (ISALevel)level;
+                        }
+                    }
+
+                    kernel = versions[0];
+                    return ISALevel::SCALAR;
+                };
+
+                kernels.push_back({name, bind, bind(active_level)});
+            }
+
+            // binds every kernel to the level, capped at what the cpu supports
+            void SetISALevel(ISALevel level);
+
+            [[nodiscard]] ISALevel GetDetectedISALevel() const;
+            [[nodiscard]] ISALevel GetActiveISALevel() const;
+
+            // one line per kernel with the level it's bound to
+            [[nodiscard]] std::string GetBindingsReport() const;
+        };
+
+        // the registry every kernel is registered with, bound to the detected level when first used
+        [[nodiscard]] KernelRegistry& GetKernelRegistry();
+
+        // the level asked for by --isa=<level> in the arguments, or the CONSOL3_ISA environment variable, for benchmarking the versions against each
+        // other, false if neither is given or the name isn't a level
+        [[nodiscard]] bool GetRequestedISALevel(int argc, char* argv[], ISALevel& out_level);
+    }
+}
+
+#endif
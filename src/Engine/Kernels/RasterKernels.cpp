@@ -0,0 +1,193 @@
+#include "RasterKernels.hpp"
+
+#include "KernelRegistry.hpp"
+
+#include <bit>
+
+#ifdef KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace Engine
+{
+    namespace Kernels
+    {
+        void FindCoveredSpanScalar(const int32_t edge_values[3], const int32_t edge_steps[3], int32_t count, int32_t& out_start, int32_t& out_end)
+        {
+            int32_t edge0 = edge_values[0];
+            int32_t edge1 = edge_values[1];
+            int32_t edge2 = edge_values[2];
+
+            int32_t x = 0;
+
+            // outside while any of the edge functions is negative
+            for (; x < count && (edge0 | edge1 | edge2) < 0; x++)
+            {
+                edge0 += edge_steps[0];
+                edge1 += edge_steps[1];
+                edge2 += edge_steps[2];
+            }
+
+            out_start = x;
+
+            for (; x < count && (edge0 | edge1 | edge2) >= 0; x++)
+            {
+                edge0 += edge_steps[0];
+                edge1 += edge_steps[1];
+                edge2 += edge_steps[2];
+            }
+
+            out_end = x;
+        }
+
+#ifdef KERNELS_X86
+        // the versions below test a register of pixels at a time, with a bit per pixel that's outside of an edge from the sign bits, the pixels past the
+        // end of the row count as outside so they end the span
+
+        KERNEL_TARGET("sse4.1")
+        static void FindCoveredSpanSSE4_1(const int32_t edge_values[3], const int32_t edge_steps[3], int32_t count, int32_t& out_start, int32_t& out_end)
+        {
+            const __m128i lane_offsets = _mm_setr_epi32(0, 1, 2, 3);
+
+            __m128i edge0 = _mm_add_epi32(_mm_set1_epi32(edge_values[0]), _mm_mullo_epi32(lane_offsets, _mm_set1_epi32(edge_steps[0])));
+            __m128i edge1 = _mm_add_epi32(_mm_set1_epi32(edge_values[1]), _mm_mullo_epi32(lane_offsets, _mm_set1_epi32(edge_steps[1])));
+            __m128i edge2 = _mm_add_epi32(_mm_set1_epi32(edge_values[2]), _mm_mullo_epi32(lane_offsets, _mm_set1_epi32(edge_steps[2])));
+
+            const __m128i step0 = _mm_set1_epi32(edge_steps[0] * 4);
+            const __m128i step1 = _mm_set1_epi32(edge_steps[1] * 4);
+            const __m128i step2 = _mm_set1_epi32(edge_steps[2] * 4);
+
+            bool found_start = false;
+            out_start        = count;
+            out_end          = count;
+
+            for (int32_t x = 0; x < count; x += 4)
+            {
+                uint32_t outside = (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(_mm_or_si128(edge0, edge1), edge2)));
+
+                if (count - x < 4)
+                    outside |= ~0u << (count - x);
+
+                if (!found_start && (~outside & 0xF) != 0)
+                {
+                    int32_t start_lane = std::countr_zero(~outside & 0xF);
+
+                    out_start   = x + start_lane;
+                    found_start = true;
+                    // only the pixels after the start can end the span
+                    outside &= ~0u << start_lane;
+                }
+
+                if (found_start && outside != 0)
+                {
+                    out_end = x + std::countr_zero(outside);
+                    return;
+                }
+
+                edge0 = _mm_add_epi32(edge0, step0);
+                edge1 = _mm_add_epi32(edge1, step1);
+                edge2 = _mm_add_epi32(edge2, step2);
+            }
+        }
+
+        KERNEL_TARGET("avx2")
+        static void FindCoveredSpanAVX2(const int32_t edge_values[3], const int32_t edge_steps[3], int32_t count, int32_t& out_start, int32_t& out_end)
+        {
+            const __m256i lane_offsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+            __m256i edge0 = _mm256_add_epi32(_mm256_set1_epi32(edge_values[0]), _mm256_mullo_epi32(lane_offsets, _mm256_set1_epi32(edge_steps[0])));
+            __m256i edge1 = _mm256_add_epi32(_mm256_set1_epi32(edge_values[1]), _mm256_mullo_epi32(lane_offsets, _mm256_set1_epi32(edge_steps[1])));
+            __m256i edge2 = _mm256_add_epi32(_mm256_set1_epi32(edge_values[2]), _mm256_mullo_epi32(lane_offsets, _mm256_set1_epi32(edge_steps[2])));
+
+            const __m256i step0 = _mm256_set1_epi32(edge_steps[0] * 8);
+            const __m256i step1 = _mm256_set1_epi32(edge_steps[1] * 8);
+            const __m256i step2 = _mm256_set1_epi32(edge_steps[2] * 8);
+
+            bool found_start = false;
+            out_start        = count;
+            out_end          = count;
+
+            for (int32_t x = 0; x < count; x += 8)
+            {
+                uint32_t outside = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_or_si256(edge0, edge1), edge2)));
+
+                if (count - x < 8)
+                    outside |= ~0u << (count - x);
+
+                if (!found_start && (~outside & 0xFF) != 0)
+                {
+                    int32_t start_lane = std::countr_zero(~outside & 0xFF);
+
+                    out_start   = x + start_lane;
+                    found_start = true;
+                    outside &= ~0u << start_lane;
+                }
+
+                if (found_start && outside != 0)
+                {
+                    out_end = x + std::countr_zero(outside);
+                    return;
+                }
+
+                edge0 = _mm256_add_epi32(edge0, step0);
+                edge1 = _mm256_add_epi32(edge1, step1);
+                edge2 = _mm256_add_epi32(edge2, step2);
+            }
+        }
+
+        KERNEL_TARGET("avx512f")
+        static void FindCoveredSpanAVX512(const int32_t edge_values[3], const int32_t edge_steps[3], int32_t count, int32_t& out_start, int32_t& out_end)
+        {
+            const __m512i lane_offsets = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+            __m512i edge0 = _mm512_add_epi32(_mm512_set1_epi32(edge_values[0]), _mm512_mullo_epi32(lane_offsets, _mm512_set1_epi32(edge_steps[0])));
+            __m512i edge1 = _mm512_add_epi32(_mm512_set1_epi32(edge_values[1]), _mm512_mullo_epi32(lane_offsets, _mm512_set1_epi32(edge_steps[1])));
+            __m512i edge2 = _mm512_add_epi32(_mm512_set1_epi32(edge_values[2]), _mm512_mullo_epi32(lane_offsets, _mm512_set1_epi32(edge_steps[2])));
+
+            const __m512i step0 = _mm512_set1_epi32(edge_steps[0] * 16);
+            const __m512i step1 = _mm512_set1_epi32(edge_steps[1] * 16);
+            const __m512i step2 = _mm512_set1_epi32(edge_steps[2] * 16);
+
+            bool found_start = false;
+            out_start        = count;
+            out_end          = count;
+
+            for (int32_t x = 0; x < count; x += 16)
+            {
+                uint32_t outside = (uint32_t)_mm512_cmplt_epi32_mask(_mm512_or_si512(_mm512_or_si512(edge0, edge1), edge2), _mm512_setzero_si512());
+
+                if (count - x < 16)
+                    outside |= ~0u << (count - x);
+
+                if (!found_start && (~outside & 0xFFFF) != 0)
+                {
+                    int32_t start_lane = std::countr_zero(~outside & 0xFFFF);
+
+                    out_start   = x + start_lane;
+                    found_start = true;
+                    outside &= ~0u << start_lane;
+                }
+
+                if (found_start && outside != 0)
+                {
+                    out_end = x + std::countr_zero(outside);
+                    return;
+                }
+
+                edge0 = _mm512_add_epi32(edge0, step0);
+                edge1 = _mm512_add_epi32(edge1, step1);
+                edge2 = _mm512_add_epi32(edge2, step2);
+            }
+        }
+#endif
+
+        void RegisterRasterKernels(KernelRegistry& registry)
+        {
+#ifdef KERNELS_X86
+            registry.Register<FindCoveredSpanKernel>("find_covered_span", find_covered_span, {FindCoveredSpanScalar, FindCoveredSpanSSE4_1, FindCoveredSpanAVX2, FindCoveredSpanAVX512});
+#else
+            registry.Register<FindCoveredSpanKernel>("find_covered_span", find_covered_span, {FindCoveredSpanScalar, nullptr, nullptr, nullptr});
+#endif
+        }
+    }
+}
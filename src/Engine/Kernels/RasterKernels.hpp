@@ -0,0 +1,25 @@
+#ifndef RASTERKERNELS_HPP
+#define RASTERKERNELS_HPP
+
+#include <cstdint>
+
+namespace Engine
+{
+    namespace Kernels
+    {
+        class KernelRegistry;
+
+        // the pixels of a row of a triangle's bounding box that are inside all three edges, from the edge function values at the first pixel of the
+        // row and how much they change for each pixel to the right, the inside of a triangle is convex so it's one span [out_start, out_end), empty
+        // when they're the same
+        using FindCoveredSpanKernel = void (*)(const int32_t edge_values[3], const int32_t edge_steps[3], int32_t count, int32_t& out_start, int32_t& out_end);
+
+        void FindCoveredSpanScalar(const int32_t edge_values[3], const int32_t edge_steps[3], int32_t count, int32_t& out_start, int32_t& out_end);
+
+        inline FindCoveredSpanKernel find_covered_span = FindCoveredSpanScalar;
+
+        void RegisterRasterKernels(KernelRegistry& registry);
+    }
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include "QualityGovernor.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Engine
+{
+    uint8_t QualityGovernor::GetMaxLevel() const
+    {
+        return tier_count + (uint8_t)std::round((1.0f - min_resolution_scale) / resolution_scale_step);
+    }
+
+    float QualityGovernor::GetResolutionScale(uint8_t level) const
+    {
+        if (level <= tier_count)
+            return 1.0f;
+
+        return std::max(min_resolution_scale, 1.0f - (level - tier_count) * resolution_scale_step);
+    }
+
+    void QualityGovernor::SetFrameTimeBudget(int64_t frame_time_budget)
+    {
+        this->frame_time_budget = frame_time_budget;
+    }
+
+    void QualityGovernor::SetTierCount(uint8_t tier_count)
+    {
+        this->tier_count = tier_count;
+
+        level               = 0;
+        frame_time_sum      = 0;
+        frames_since_update = 0;
+        measuring_change    = false;
+
+        // the speedup of level 0 is never used
+        level_speedups.assign(GetMaxLevel() + 1, guessed_tier_speedup);
+
+        // the frame time grows with the pixel count
+        for (uint8_t l = tier_count + 1; l <= GetMaxLevel(); l++)
+        {
+            float scale_ratio = GetResolutionScale(l - 1) / GetResolutionScale(l);
+            level_speedups[l] = scale_ratio * scale_ratio;
+        }
+    }
+
+    bool QualityGovernor::Update(int64_t delta)
+    {
+        if (frame_time_budget <= 0)
+            return false;
+
+        frame_time_sum += delta;
+
+        if (++frames_since_update < update_frame_interval)
+            return false;
+
+        float average_frame_time = (float)frame_time_sum / frames_since_update;
+
+        frame_time_sum      = 0;
+        frames_since_update = 0;
+
+        // the first average after a change shows how much faster the lower of the two levels really is, a lower level is never slower so what
+        // looks like it is noise
+        if (measuring_change)
+        {
+            if (level > changed_from_level)
+                level_speedups[level] = std::max(1.0f, frame_time_before_change / std::max(average_frame_time, 1.0f));
+            else
+                level_speedups[changed_from_level] = std::max(1.0f, average_frame_time / std::max(frame_time_before_change, 1.0f));
+
+            measuring_change = false;
+        }
+
+        uint8_t new_level = level;
+
+        if (average_frame_time > frame_time_budget && level < GetMaxLevel())
+            new_level = level + 1;
+        else if (level > 0 && average_frame_time * level_speedups[level] < frame_time_budget * raise_headroom)
+            new_level = level - 1;
+
+        if (new_level == level)
+            return false;
+
+        measuring_change         = true;
+        changed_from_level       = level;
+        frame_time_before_change = average_frame_time;
+        level                    = new_level;
+
+        return true;
+    }
+
+    uint8_t QualityGovernor::GetQualityLevel() const
+    {
+        return std::min(level, tier_count);
+    }
+
+    float QualityGovernor::GetResolutionScale() const
+    {
+        return GetResolutionScale(level);
+    }
+}
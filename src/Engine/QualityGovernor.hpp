@@ -0,0 +1,57 @@
+#ifndef QUALITYGOVERNOR_HPP
+#define QUALITYGOVERNOR_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+    // keeps the frame time under a budget by lowering the quality a level at a time, the levels first give up the quality tiers of the game and
+    // then drop the render resolution in steps, going back up a level when the frame time there is predicted to still fit, a budget of 0 keeps the
+    // full quality
+    class QualityGovernor
+    {
+    private:
+        int64_t frame_time_budget = 0;
+        uint8_t tier_count        = 0;
+        uint8_t level             = 0;
+
+        // the frames since the last decision, the level is only changed on their average so it doesn't follow single slow frames
+        int64_t frame_time_sum       = 0;
+        uint16_t frames_since_update = 0;
+
+        // how many times faster each level renders than the one before it, the resolution levels start from the pixel count and the quality
+        // tiers from a guess, they are measured from the frame times around every change
+        std::vector<float> level_speedups;
+
+        // the level the last change came from and the average frame time there, the average after the change is compared to it
+        bool measuring_change          = false;
+        uint8_t changed_from_level     = 0;
+        float frame_time_before_change = 0.0f;
+
+        static constexpr float min_resolution_scale     = 0.5f;
+        static constexpr float resolution_scale_step    = 0.1f;
+        static constexpr uint16_t update_frame_interval = 15;
+        static constexpr float guessed_tier_speedup     = 1.25f;
+        // going up a level has to leave this much of the budget free, so the noise doesn't flip between two levels
+        static constexpr float raise_headroom = 0.9f;
+
+        [[nodiscard]] uint8_t GetMaxLevel() const;
+        [[nodiscard]] float GetResolutionScale(uint8_t level) const;
+
+    public:
+        // in milliseconds
+        void SetFrameTimeBudget(int64_t frame_time_budget);
+        // starts over from the full quality
+        void SetTierCount(uint8_t tier_count);
+
+        // returns true when the level changed
+        bool Update(int64_t delta);
+
+        // how many of the quality tiers are given up
+        [[nodiscard]] uint8_t GetQualityLevel() const;
+        [[nodiscard]] float GetResolutionScale() const;
+    };
+}
+
+#endif
@@ -65,9 +65,15 @@ namespace Engine
             return !normal_map_resource.empty();
         }
 
+        uint32_t AbstractMesh::GetChangeCount() const
+        {
+            return change_count + transform.GetChangeCount();
+        }
+
         AbstractMesh& AbstractMesh::SetModelResource(const std::string& model_resource)
         {
             this->model_resource = model_resource;
+            change_count++;
 
             return *this;
         }
@@ -75,6 +81,7 @@ namespace Engine
         AbstractMesh& AbstractMesh::SetTextureResource(const std::string& texture_resource)
         {
             this->texture_resource = texture_resource;
+            change_count++;
 
             return *this;
         }
@@ -82,6 +89,7 @@ namespace Engine
         AbstractMesh& AbstractMesh::SetNormalMapResource(const std::string& normal_map_resource)
         {
             this->normal_map_resource = normal_map_resource;
+            change_count++;
 
             return *this;
         }
@@ -89,6 +97,7 @@ namespace Engine
         AbstractMesh& AbstractMesh::SetColor(const RGBColor& color)
         {
             this->color = color;
+            change_count++;
 
             return *this;
         }
@@ -119,6 +128,7 @@ namespace Engine
         AbstractMesh& AbstractMesh::SetMaterialProperties(const MaterialProperties& material_properties)
         {
             this->material_properties = material_properties;
+            change_count++;
 
             return *this;
         }
@@ -9,6 +9,7 @@
 #include "Math/Vector3.hpp"
 #include "Transform.hpp"
 
+#include <cstdint>
 #include <string>
 
 namespace Engine
@@ -36,6 +37,9 @@ namespace Engine
 
             MaterialProperties material_properties;
 
+            // the sets of everything but the transform, which counts it's own
+            uint32_t change_count = 0;
+
         public:
             AbstractMesh();
 
@@ -50,6 +54,8 @@ namespace Engine
             [[nodiscard]] const Transform& GetTransform() const;
             [[nodiscard]] bool IsTextured() const;
             [[nodiscard]] bool IsNormalMapped() const;
+            // goes up whenever something that changes how the mesh is drawn is set, animated meshes also count the animation steps
+            [[nodiscard]] uint32_t GetChangeCount() const;
 
             [[nodiscard]] virtual bool IsAnimated() const = 0;
 
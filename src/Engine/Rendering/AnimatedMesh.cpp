@@ -19,6 +19,7 @@ namespace Engine
         void AnimatedMesh::PlayAnimation(const std::string& animation, float fps)
         {
             is_animating = true;
+            change_count++;
 
             anim_current_progress = 0;
             anim_current_fps      = fps;
@@ -57,6 +58,7 @@ namespace Engine
             float progress = (float)difference / frametime_mili;
 
             anim_current_progress += progress;
+            change_count++;
 
             if (anim_current_progress >= 1.0f)
             {
@@ -1,6 +1,7 @@
 #include "AnimatedModel.hpp"
 #include "Math/Util/MathUtil.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace Engine
@@ -9,16 +10,62 @@ namespace Engine
     {
         using namespace Math;
 
-        AnimatedModel::AnimatedModel()
+        AnimatedModel::AnimatedModel() : AnimatedModel(std::vector<Frame>(), std::vector<uint32_t>(), std::map<std::string, Animation>())
         {
         }
 
         AnimatedModel::AnimatedModel(const std::vector<Frame>& frames, const std::vector<uint32_t>& indices, const std::map<std::string, Animation>& animations) :
-            frames(frames),
-            indices(std::make_shared<std::vector<uint32_t>>()),
-            animations(animations)
+            animations(animations),
+            bounding_radius(0),
+            used_poses(0)
         {
-            *this->indices.get() = indices;
+            AddLod(frames, indices);
+
+            for (const Frame& frame : frames)
+            {
+                for (const Vertex& vertex : *frame.vertices.get())
+                    bounding_radius = std::max(bounding_radius, vertex.GetPosition().GetLength());
+            }
+        }
+
+        void AnimatedModel::AddLod(const std::vector<Frame>& frames, const std::vector<uint32_t>& indices)
+        {
+            std::vector<std::vector<float>> frames_components;
+
+            for (const Frame& frame : frames)
+            {
+                const std::vector<Vertex>& vertices = *frame.vertices.get();
+                uint32_t vertex_count               = (uint32_t)vertices.size();
+
+                std::vector<float> components(vertex_components * vertex_count);
+
+                for (uint32_t i = 0; i < vertex_count; i++)
+                {
+                    const Vertex& vertex = vertices[i];
+
+                    const float vertex_values[vertex_components] = {vertex.GetPosition().x,
+                                                                    vertex.GetPosition().y,
+                                                                    vertex.GetPosition().z,
+                                                                    vertex.GetNormal().x,
+                                                                    vertex.GetNormal().y,
+                                                                    vertex.GetNormal().z,
+                                                                    vertex.GetTangent().x,
+                                                                    vertex.GetTangent().y,
+                                                                    vertex.GetTangent().z,
+                                                                    vertex.GetBitangent().x,
+                                                                    vertex.GetBitangent().y,
+                                                                    vertex.GetBitangent().z,
+                                                                    vertex.GetTextureCoords().x,
+                                                                    vertex.GetTextureCoords().y};
+
+                    for (uint32_t c = 0; c < vertex_components; c++)
+                        components[c * vertex_count + i] = vertex_values[c];
+                }
+
+                frames_components.push_back(std::move(components));
+            }
+
+            lods.push_back({frames, frames_components, std::make_shared<std::vector<uint32_t>>(indices)});
         }
 
         const Animation& AnimatedModel::GetAnimation(const std::string& name) const
@@ -26,9 +73,18 @@ namespace Engine
             return animations.at(name);
         }
 
-        VertexBuffer AnimatedModel::GetVertexBuffer(const std::string& animation_name, float interpolation)
+        VertexBuffer AnimatedModel::GetVertexBuffer(const std::string& animation_name, float interpolation, uint32_t lod)
         {
-            if (animations.find(animation_name) == animations.end())
+            lod = std::min(lod, (uint32_t)lods.size() - 1);
+
+            const Lod& level = lods[lod];
+
+            const std::vector<Frame>& frames                      = level.frames;
+            const std::shared_ptr<std::vector<uint32_t>>& indices = level.indices;
+
+            std::map<std::string, Animation>::const_iterator animation = animations.find(animation_name);
+
+            if (animation == animations.end())
             {
                 if (!frames.empty())
                     return VertexBuffer(frames[0].vertices, indices);
@@ -36,34 +92,99 @@ namespace Engine
                 return VertexBuffer();
             }
 
-            Animation anim = animations.at(animation_name);
+            const Animation& anim = animation->second;
 
             float calculated_frame = Util::Lerp(interpolation, (float)anim.start_frame, (float)anim.end_frame);
 
-            float calculated_frame_intpart   = 0;
-            float calculated_frame_floatpart = std::modf(calculated_frame, &calculated_frame_intpart);
+            uint32_t quantized_frame = (uint32_t)std::lround(calculated_frame * pose_quantization);
+            uint32_t from_frame      = quantized_frame / pose_quantization;
+            uint32_t blend_step      = quantized_frame % pose_quantization;
 
             // we are currently at a discrete frame, we can just return it
-            if (calculated_frame_floatpart == 0)
-                return VertexBuffer(frames[(uint32_t)calculated_frame_intpart].vertices, indices);
+            if (blend_step == 0)
+                return VertexBuffer(frames[from_frame].vertices, indices);
+
+            // some other mesh already needed this pose in this frame
+            uint64_t key = ((uint64_t)lod << 32) | quantized_frame;
+
+            for (uint32_t i = 0; i < used_poses; i++)
+            {
+                if (cached_poses[i].key == key)
+                    return VertexBuffer(cached_poses[i].blend_buffer.vertices, indices);
+            }
 
             // we must interpolate it
 
-            uint32_t from_frame = (uint32_t)calculated_frame_intpart;
-            uint32_t to_frame   = (uint32_t)calculated_frame_intpart + 1;
+            if (used_poses == cached_poses.size())
+                cached_poses.emplace_back();
+
+            CachedPose& pose = cached_poses[used_poses];
+            used_poses++;
+
+            pose.key = key;
+
+            AnimationBlendBuffer& blend_buffer = pose.blend_buffer;
 
-            std::vector<Vertex> vertices;
+            uint32_t to_frame     = from_frame + 1;
+            uint32_t vertex_count = (uint32_t)frames[from_frame].vertices->size();
+            float blend_amount    = (float)blend_step / pose_quantization;
 
-            for (uint32_t i = 0; i < frames[from_frame].vertices->size(); i++)
+            // only (re)allocated the first time, or when the buffer was last used by a level with another vertex count
+            if (!blend_buffer.vertices || blend_buffer.vertices->size() != vertex_count)
             {
-                const Vertex& from_vert = frames[from_frame].vertices->at(i);
-                const Vertex& to_vert   = frames[to_frame].vertices->at(i);
+                blend_buffer.vertices = std::make_shared<std::vector<Vertex>>(*frames[from_frame].vertices.get());
+                blend_buffer.components.resize(vertex_components * vertex_count);
+            }
+
+            const float* from_components = level.frames_components[from_frame].data();
+            const float* to_components   = level.frames_components[to_frame].data();
+            float* blended_components    = blend_buffer.components.data();
+
+            // a single flat loop over all the components, simple enough for the compiler to vectorize
+            for (uint32_t i = 0; i < vertex_components * vertex_count; i++)
+                blended_components[i] = from_components[i] + (to_components[i] - from_components[i]) * blend_amount;
+
+            std::vector<Vertex>& vertices = *blend_buffer.vertices.get();
+
+            for (uint32_t i = 0; i < vertex_count; i++)
+            {
+                const float* component = blended_components + i;
+
+                vertices[i]
+                    .SetPosition(Vector3(component[0], component[vertex_count], component[vertex_count * 2]))
+                    .SetNormal(Vector3(component[vertex_count * 3], component[vertex_count * 4], component[vertex_count * 5]))
+                    .SetTangent(Vector3(component[vertex_count * 6], component[vertex_count * 7], component[vertex_count * 8]))
+                    .SetBitangent(Vector3(component[vertex_count * 9], component[vertex_count * 10], component[vertex_count * 11]))
+                    .SetTextureCoords(Vector2(component[vertex_count * 12], component[vertex_count * 13]));
+            }
+
+            return VertexBuffer(blend_buffer.vertices, indices);
+        }
+
+        void AnimatedModel::ClearPoseCache()
+        {
+            used_poses = 0;
+        }
+
+        uint32_t AnimatedModel::GetLodCount() const
+        {
+            return (uint32_t)lods.size();
+        }
 
-                vertices.push_back(from_vert.GetLerped(to_vert, calculated_frame_floatpart));
+        uint32_t AnimatedModel::GetLodForTriangleBudget(uint32_t max_triangles) const
+        {
+            for (uint32_t lod = 0; lod < lods.size(); lod++)
+            {
+                if (lods[lod].indices->size() / 3 <= max_triangles)
+                    return lod;
             }
 
-            // self stored vertices by the vertexbuffer
-            return VertexBuffer(vertices, indices);
+            return (uint32_t)lods.size() - 1;
+        }
+
+        float AnimatedModel::GetBoundingRadius() const
+        {
+            return bounding_radius;
         }
     }
 }
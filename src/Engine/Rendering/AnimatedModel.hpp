@@ -19,18 +19,57 @@ namespace Engine
         class AnimatedModel
         {
         private:
-            std::vector<Frame> frames;
-            std::shared_ptr<std::vector<uint32_t>> indices;
+            struct Lod
+            {
+                std::vector<Frame> frames;
+                // the frames as a structure of arrays, all the values of each vertex component one after another, so two frames blend in a single loop
+                std::vector<std::vector<float>> frames_components;
+                std::shared_ptr<std::vector<uint32_t>> indices;
+            };
+
+            struct CachedPose
+            {
+                // the level of detail and the quantized frame position
+                uint64_t key;
+
+                AnimationBlendBuffer blend_buffer;
+            };
+
+            // position, normal, tangent, bitangent and texture coordinates
+            static constexpr uint32_t vertex_components = 14;
+            // the steps a blend between two keyframes is rounded to, so meshes at almost the same point of an animation share the pose
+            static constexpr uint32_t pose_quantization = 16;
+
+            // the full model is the first level, every next level is simpler, the animations are the same for all of them
+            std::vector<Lod> lods;
 
             std::map<std::string, Animation> animations;
 
+            // from the model origin over all the frames, enough to estimate how big the model is on screen
+            float bounding_radius;
+
+            // the interpolated poses of the current frame, shared by all the meshes using the model, the first used_poses are valid and the rest
+            // are kept allocated to be reused in the next frames
+            std::vector<CachedPose> cached_poses;
+            uint32_t used_poses;
+
         public:
             AnimatedModel();
             AnimatedModel(const std::vector<Frame>& frames, const std::vector<uint32_t>& indices, const std::map<std::string, Animation>& animations);
 
+            void AddLod(const std::vector<Frame>& frames, const std::vector<uint32_t>& indices);
+
             [[nodiscard]] const Animation& GetAnimation(const std::string& name) const;
 
-            VertexBuffer GetVertexBuffer(const std::string& animation_name, float interpolation);
+            // interpolated poses are blended once per frame and then shared, the returned vertex buffer is valid until the pose cache is cleared
+            VertexBuffer GetVertexBuffer(const std::string& animation_name, float interpolation, uint32_t lod = 0);
+            // should be called once every frame
+            void ClearPoseCache();
+
+            [[nodiscard]] uint32_t GetLodCount() const;
+            // the most detailed level that has at most max_triangles triangles, or the simplest one if none does
+            [[nodiscard]] uint32_t GetLodForTriangleBudget(uint32_t max_triangles) const;
+            [[nodiscard]] float GetBoundingRadius() const;
         };
     }
 }
@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Engine
 {
@@ -24,6 +25,13 @@ namespace Engine
             uint32_t start_frame;
             uint32_t end_frame;
         };
+
+        // kept by each animated mesh and reused every frame, so blending between keyframes doesn't allocate
+        struct AnimationBlendBuffer
+        {
+            std::vector<float> components;
+            std::shared_ptr<std::vector<Vertex>> vertices;
+        };
     }
 }
 
@@ -157,6 +157,11 @@ namespace Engine
             transform.SetRotation(rotation.GetConjugate());
         }
 
+        uint32_t Camera::GetChangeCount() const
+        {
+            return transform.GetChangeCount();
+        }
+
         [[nodiscard]] DepthBuffer& Camera::GetDepthBuffer()
         {
             return depthbuffer;
@@ -65,6 +65,9 @@ namespace Engine
             void RotateYaw(float amount);
             void RotateRoll(float amount);
 
+            // goes up with every move and rotation
+            [[nodiscard]] uint32_t GetChangeCount() const;
+
             [[nodiscard]] DepthBuffer& GetDepthBuffer();
             void ClearDepthBuffer();
         };
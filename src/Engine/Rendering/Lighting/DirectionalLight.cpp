@@ -1,6 +1,7 @@
 #include "DirectionalLight.hpp"
 
 #include "Engine/Rendering/Transform.hpp"
+#include "LightTable.hpp"
 #include "Math/Matrix4.hpp"
 #include "Math/Util/MathUtil.hpp"
 #include "Math/Vector3.hpp"
@@ -56,19 +57,21 @@ namespace Engine
             void DirectionalLight::SetDirection(const Vector3& direction)
             {
                 this->direction = direction;
+                change_count++;
 
                 UpdateViewMatrix();
             }
 
-            RGBColor DirectionalLight::GetColorAt(const Vector3& position, const Vector3& normal, const Vector3& cam_pos, const MaterialProperties& material_properties) const
+            float DirectionalLight::GetAttenuationAt(const Vector3& position, Vector3& out_light_vector) const
             {
-                float amount = normal.GetDotProduct(-direction);
+                out_light_vector = direction;
 
-                amount += GetSpecularHighlightAt(position, normal, cam_pos, direction, material_properties);
-
-                amount = std::clamp(amount, 0.0f, 1.0f);
+                return 1.0f;
+            }
 
-                return color.GetBlendMultiplied(amount);
+            void DirectionalLight::AddToLightTable(LightTable& light_table)
+            {
+                light_table.AddDirectionalLight(direction, color, -1);
             }
 
             bool DirectionalLight::IsShadowCaster() const
@@ -84,6 +87,7 @@ namespace Engine
             void DirectionalLight::SetColor(RGBColor color)
             {
                 this->color = color;
+                change_count++;
             }
 
             std::optional<bool> DirectionalLight::IsLinearProjection() const
@@ -7,6 +7,9 @@
 #include "Math/Matrix4.hpp"
 #include "Math/Vector3.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -27,27 +30,67 @@ namespace Engine
                 float c;
             };
 
+            struct LightTable;
+
             class ILight
             {
             protected:
+                // goes up with every set, the lights count them in their setters
+                uint32_t change_count = 0;
+
                 ILight()
                 {
                 }
 
                 virtual ~ILight() = default;
 
-                [[nodiscard]] inline float GetSpecularHighlightAt(const Vector3& position, const Vector3& normal, const Vector3& cam_pos, const Vector3& light_dir, const MaterialProperties& material_properties) const
+                [[nodiscard]] static inline float GetSpecularHighlightAt(const Vector3& normal, const Vector3& view_dir, const Vector3& light_dir, const MaterialProperties& material_properties)
                 {
-                    Vector3 view_dir = cam_pos - position;
-                    Vector3 half_dir = (view_dir - light_dir).GetNormalized();
-                    float specular   = half_dir.GetDotProduct(normal);
-                    specular         = std::pow(specular, material_properties.specular_factor);
+                    const Util::PowTable<>* specular_table = material_properties.GetSpecularTable();
+
+                    if (specular_table == nullptr)
+                        return 0.0f;
 
-                    return specular * material_properties.specular_intensity;
+                    // the table clamps negative bases to 0, so there is no highlight facing away from the light even for even specular factors
+                    Vector3 half_dir = (view_dir - light_dir).GetFastNormalized();
+                    float specular   = specular_table->Get(half_dir.GetDotProduct(normal));
+
+                    return specular * material_properties.GetSpecularIntensity();
                 }
 
             public:
-                [[nodiscard]] virtual RGBColor GetColorAt(const Vector3& position, const Vector3& normal, const Vector3& cam_pos, const MaterialProperties& material_properties) const = 0;
+                // how much of the light reaches the position, 0 if none, and the vector from the light to the position, not normalized
+                [[nodiscard]] virtual float GetAttenuationAt(const Vector3& position, Vector3& out_light_vector) const = 0;
+
+                [[nodiscard]] RGBColor GetColorAt(const Vector3& position, const Vector3& normal, const Vector3& cam_pos, const MaterialProperties& material_properties) const
+                {
+                    Vector3 light_vector;
+                    float attenuation = GetAttenuationAt(position, light_vector);
+
+                    if (attenuation <= 0.0f)
+                        return RGBColor(0, 0, 0);
+
+                    return GetColor().GetBlendMultiplied(GetLightAmount(light_vector.GetFastNormalized(), normal, cam_pos - position, attenuation, material_properties));
+                }
+
+                // the directions can be in any space as long as they are all in the same one, the light direction is normalized and the view direction
+                // goes from the position to the camera
+                [[nodiscard]] static inline float GetLightAmount(const Vector3& light_dir, const Vector3& normal, const Vector3& view_dir, float attenuation, const MaterialProperties& material_properties)
+                {
+                    float amount = normal.GetDotProduct(-light_dir) * attenuation;
+
+                    amount += GetSpecularHighlightAt(normal, view_dir, light_dir, material_properties);
+
+                    return std::clamp(amount, 0.0f, 1.0f);
+                }
+
+                [[nodiscard]] uint32_t GetChangeCount() const
+                {
+                    return change_count;
+                }
+
+                // adds the light as it is right now, the table is rebuilt every frame
+                virtual void AddToLightTable(LightTable& light_table) = 0;
 
                 [[nodiscard]] virtual bool IsShadowCaster() const = 0;
                 [[nodiscard]] virtual RGBColor GetColor() const   = 0;
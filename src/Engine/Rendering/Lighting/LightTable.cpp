@@ -0,0 +1,191 @@
+#include "LightTable.hpp"
+
+#include "Math/Util/MathUtil.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Engine
+{
+    namespace Rendering
+    {
+        namespace Lighting
+        {
+            void LightTable::Clear()
+            {
+                directional_directions.clear();
+                directional_colors.clear();
+                directional_shadow_indices.clear();
+
+                point_positions.clear();
+                point_ranges.clear();
+                point_attenuations.clear();
+                point_colors.clear();
+
+                spot_positions.clear();
+                spot_directions.clear();
+                spot_ranges.clear();
+                spot_cos_angles.clear();
+                spot_attenuations.clear();
+                spot_colors.clear();
+                spot_shadow_indices.clear();
+
+                shadow_maps.clear();
+
+                cluster_point_offsets.clear();
+                cluster_point_lights.clear();
+                cluster_spot_offsets.clear();
+                cluster_spot_lights.clear();
+            }
+
+            void LightTable::BuildClusters()
+            {
+                if (point_positions.empty() && spot_positions.empty())
+                    return;
+
+                Vector3 cluster_max = Vector3(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+                cluster_min         = Vector3(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+
+                // the grid covers the bounding boxes of all the ranges, nothing outside of it is lit by these lights
+                auto add_bounds = [&](const std::vector<Vector3>& positions, const std::vector<float>& ranges)
+                {
+                    for (size_t i = 0; i < positions.size(); i++)
+                    {
+                        cluster_min = Vector3(std::min(cluster_min.x, positions[i].x - ranges[i]), std::min(cluster_min.y, positions[i].y - ranges[i]), std::min(cluster_min.z, positions[i].z - ranges[i]));
+                        cluster_max = Vector3(std::max(cluster_max.x, positions[i].x + ranges[i]), std::max(cluster_max.y, positions[i].y + ranges[i]), std::max(cluster_max.z, positions[i].z + ranges[i]));
+                    }
+                };
+
+                add_bounds(point_positions, point_ranges);
+                add_bounds(spot_positions, spot_ranges);
+
+                Vector3 extent = cluster_max - cluster_min;
+
+                cluster_scale = Vector3(cluster_resolution / std::max(extent.x, 0.0001f), cluster_resolution / std::max(extent.y, 0.0001f), cluster_resolution / std::max(extent.z, 0.0001f));
+
+                BinLights(point_positions, point_ranges, cluster_point_offsets, cluster_point_lights);
+                // the cone is not taken into account, a spot light is binned by the sphere of it's range
+                BinLights(spot_positions, spot_ranges, cluster_spot_offsets, cluster_spot_lights);
+            }
+
+            void LightTable::BinLights(const std::vector<Vector3>& positions, const std::vector<float>& ranges, std::vector<uint32_t>& out_offsets, std::vector<uint32_t>& out_lights) const
+            {
+                constexpr uint32_t cluster_count = cluster_resolution * cluster_resolution * cluster_resolution;
+
+                Vector3 cell_size = Vector3(1.0f / cluster_scale.x, 1.0f / cluster_scale.y, 1.0f / cluster_scale.z);
+
+                // first counted and then filled in, so each cell's lights are contiguous
+                out_offsets.assign(cluster_count + 1, 0);
+
+                for (uint32_t pass = 0; pass < 2; pass++)
+                {
+                    if (pass == 1)
+                    {
+                        for (uint32_t c = 0; c < cluster_count; c++)
+                            out_offsets[c + 1] += out_offsets[c];
+
+                        out_lights.resize(out_offsets[cluster_count]);
+                    }
+
+                    // where the next light of each cell goes in the fill pass
+                    std::vector<uint32_t> cursors(out_offsets.begin(), out_offsets.end() - 1);
+
+                    for (uint32_t i = 0; i < positions.size(); i++)
+                    {
+                        const Vector3& position = positions[i];
+                        float range             = ranges[i];
+
+                        uint32_t min_x = (uint32_t)std::clamp((int32_t)((position.x - range - cluster_min.x) * cluster_scale.x), 0, (int32_t)cluster_resolution - 1);
+                        uint32_t min_y = (uint32_t)std::clamp((int32_t)((position.y - range - cluster_min.y) * cluster_scale.y), 0, (int32_t)cluster_resolution - 1);
+                        uint32_t min_z = (uint32_t)std::clamp((int32_t)((position.z - range - cluster_min.z) * cluster_scale.z), 0, (int32_t)cluster_resolution - 1);
+                        uint32_t max_x = (uint32_t)std::clamp((int32_t)((position.x + range - cluster_min.x) * cluster_scale.x), 0, (int32_t)cluster_resolution - 1);
+                        uint32_t max_y = (uint32_t)std::clamp((int32_t)((position.y + range - cluster_min.y) * cluster_scale.y), 0, (int32_t)cluster_resolution - 1);
+                        uint32_t max_z = (uint32_t)std::clamp((int32_t)((position.z + range - cluster_min.z) * cluster_scale.z), 0, (int32_t)cluster_resolution - 1);
+
+                        for (uint32_t z = min_z; z <= max_z; z++)
+                        {
+                            for (uint32_t y = min_y; y <= max_y; y++)
+                            {
+                                for (uint32_t x = min_x; x <= max_x; x++)
+                                {
+                                    Vector3 cell_min = cluster_min + Vector3(x * cell_size.x, y * cell_size.y, z * cell_size.z);
+                                    Vector3 cell_max = cell_min + cell_size;
+
+                                    // the closest point of the cell to the light
+                                    Vector3 closest = Vector3(std::clamp(position.x, cell_min.x, cell_max.x), std::clamp(position.y, cell_min.y, cell_max.y), std::clamp(position.z, cell_min.z, cell_max.z));
+
+                                    if ((closest - position).GetLengthSquared() > range * range)
+                                        continue;
+
+                                    uint32_t cell = (z * cluster_resolution + y) * cluster_resolution + x;
+
+                                    if (pass == 0)
+                                        out_offsets[cell + 1]++;
+                                    else
+                                        out_lights[cursors[cell]++] = i;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            int32_t LightTable::AddShadowMap(const LightShadowMap& shadow_map)
+            {
+                if (!shadows_enabled || shadow_maps.size() >= max_shadow_maps)
+                    return -1;
+
+                shadow_maps.push_back(shadow_map);
+
+                return (int32_t)shadow_maps.size() - 1;
+            }
+
+            void LightTable::AddDirectionalLight(const Vector3& direction, RGBColor color, int32_t shadow_index)
+            {
+                directional_directions.push_back(direction);
+                directional_colors.push_back(color);
+                directional_shadow_indices.push_back(shadow_index);
+            }
+
+            void LightTable::AddPointLight(const Vector3& position, float range, const Attenuation& attenuation, RGBColor color)
+            {
+                point_positions.push_back(position);
+                point_ranges.push_back(range);
+                point_attenuations.push_back(attenuation);
+                point_colors.push_back(color);
+            }
+
+            void LightTable::AddSpotLight(const Vector3& position, const Vector3& direction, float range, float angle, const Attenuation& attenuation, RGBColor color, int32_t shadow_index)
+            {
+                spot_positions.push_back(position);
+                spot_directions.push_back(direction);
+                spot_ranges.push_back(range);
+                spot_cos_angles.push_back(std::cos(Math::Util::ToRadians(angle)));
+                spot_attenuations.push_back(attenuation);
+                spot_colors.push_back(color);
+                spot_shadow_indices.push_back(shadow_index);
+            }
+
+            size_t LightTable::GetLightCount() const
+            {
+                return directional_directions.size() + point_positions.size() + spot_positions.size();
+            }
+
+            int32_t LightTable::GetClusterIndex(const Vector3& position) const
+            {
+                if (cluster_point_offsets.empty())
+                    return -1;
+
+                float x = (position.x - cluster_min.x) * cluster_scale.x;
+                float y = (position.y - cluster_min.y) * cluster_scale.y;
+                float z = (position.z - cluster_min.z) * cluster_scale.z;
+
+                if (!(x >= 0.0f && x < cluster_resolution) || !(y >= 0.0f && y < cluster_resolution) || !(z >= 0.0f && z < cluster_resolution))
+                    return -1;
+
+                return ((int32_t)z * cluster_resolution + (int32_t)y) * cluster_resolution + (int32_t)x;
+            }
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#ifndef LIGHTTABLE_HPP
+#define LIGHTTABLE_HPP
+
+#include "Display/RGBColor.hpp"
+#include "Engine/Rendering/DepthBuffer.hpp"
+#include "ILight.hpp"
+#include "Math/Matrix4.hpp"
+#include "Math/Vector3.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+    namespace Rendering
+    {
+        namespace Lighting
+        {
+            using namespace Display;
+            using namespace Math;
+
+            // what the shadow pass and the lighting need from a shadow casting light, the lights keep owning everything pointed to
+            struct LightShadowMap
+            {
+                Vector3 position;
+                const Matrix4* view_mat;
+                const Matrix4* projection_mat;
+                DepthBuffer* depthbuffer;
+                float bias;
+                bool is_linear_projection;
+            };
+
+            // the lights of a frame flattened by type, so lighting a pixel is a tight loop per type over packed arrays instead of virtual calls
+            // through shared pointers, the lights are numbered in the order of the table: directional, point and then spot lights
+            struct LightTable
+            {
+                // the shadow indices are indices in shadow_maps and in the positions in the lights' space given to the lighting, -1 without shadows
+                std::vector<Vector3> directional_directions;
+                std::vector<RGBColor> directional_colors;
+                std::vector<int32_t> directional_shadow_indices;
+
+                std::vector<Vector3> point_positions;
+                std::vector<float> point_ranges;
+                std::vector<Attenuation> point_attenuations;
+                std::vector<RGBColor> point_colors;
+
+                std::vector<Vector3> spot_positions;
+                std::vector<Vector3> spot_directions;
+                std::vector<float> spot_ranges;
+                // the cosine of the half angle of the cone, so the cone test is a dot product
+                std::vector<float> spot_cos_angles;
+                std::vector<Attenuation> spot_attenuations;
+                std::vector<RGBColor> spot_colors;
+                std::vector<int32_t> spot_shadow_indices;
+
+                // the shaders keep a fixed array per shadow map, the lights past the limit are added without a shadow map
+                static constexpr size_t max_shadow_maps = 10;
+
+                std::vector<LightShadowMap> shadow_maps;
+                // when false the shadow casters are added without a shadow map, it's kept through clearing the table
+                bool shadows_enabled = true;
+
+                // the point and spot lights binned into a grid over the space their ranges cover, so a position only goes through the lights
+                // that can reach it's cell, the lights of cell i are [offsets[i], offsets[i + 1]) in the cell lights
+                static constexpr uint32_t cluster_resolution = 16;
+
+                Vector3 cluster_min;
+                // cells per unit along each axis
+                Vector3 cluster_scale;
+
+                std::vector<uint32_t> cluster_point_offsets;
+                std::vector<uint32_t> cluster_point_lights;
+                std::vector<uint32_t> cluster_spot_offsets;
+                std::vector<uint32_t> cluster_spot_lights;
+
+                void Clear();
+                // done after all the lights are added
+                void BuildClusters();
+
+                // returns the shadow index of the light, -1 when the shadows are disabled or there are already max_shadow_maps
+                int32_t AddShadowMap(const LightShadowMap& shadow_map);
+                void AddDirectionalLight(const Vector3& direction, RGBColor color, int32_t shadow_index);
+                void AddPointLight(const Vector3& position, float range, const Attenuation& attenuation, RGBColor color);
+                void AddSpotLight(const Vector3& position, const Vector3& direction, float range, float angle, const Attenuation& attenuation, RGBColor color, int32_t shadow_index);
+
+                [[nodiscard]] size_t GetLightCount() const;
+                // -1 outside of the grid, where no point or spot light reaches
+                [[nodiscard]] int32_t GetClusterIndex(const Vector3& position) const;
+
+            private:
+                void BinLights(const std::vector<Vector3>& positions, const std::vector<float>& ranges, std::vector<uint32_t>& out_offsets, std::vector<uint32_t>& out_lights) const;
+            };
+        }
+    }
+}
+
+#endif
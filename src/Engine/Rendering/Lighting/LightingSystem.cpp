@@ -2,9 +2,11 @@
 
 #include "Engine/Rendering/Transform.hpp"
 #include "Engine/Rendering/Vertex.hpp"
+#include "Math/Util/FastMath.hpp"
 #include "Math/Util/MathUtil.hpp"
 #include "Math/Vector3.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <vector>
@@ -24,21 +26,69 @@ namespace Engine
             void LightingSystem::AddLight(std::shared_ptr<ILight> light)
             {
                 lights.push_back(std::move(light));
+                change_count++;
             }
 
             void LightingSystem::RemoveLight(int index)
             {
+                change_count += lights[index]->GetChangeCount() + 1;
                 lights.erase(lights.begin() + index);
             }
 
-            const std::vector<std::shared_ptr<ILight>> LightingSystem::GetLights() const
+            const std::vector<std::shared_ptr<ILight>>& LightingSystem::GetLights() const
             {
                 return lights;
             }
 
+            uint32_t LightingSystem::GetChangeCount() const
+            {
+                uint32_t total_change_count = change_count;
+
+                for (const std::shared_ptr<ILight>& light : lights)
+                    total_change_count += light->GetChangeCount();
+
+                return total_change_count;
+            }
+
+            void LightingSystem::UpdateLightTable()
+            {
+                light_table.Clear();
+
+                for (const std::shared_ptr<ILight>& light : lights)
+                    light->AddToLightTable(light_table);
+
+                light_table.BuildClusters();
+            }
+
+            const LightTable& LightingSystem::GetLightTable() const
+            {
+                return light_table;
+            }
+
+            void LightingSystem::GetLightVectorsAt(const Vector3& position, Vector3 out_light_vectors[]) const
+            {
+                size_t light_index = 0;
+
+                for (const Vector3& direction : light_table.directional_directions)
+                    out_light_vectors[light_index++] = direction;
+
+                for (const Vector3& light_position : light_table.point_positions)
+                    out_light_vectors[light_index++] = position - light_position;
+
+                for (const Vector3& light_position : light_table.spot_positions)
+                    out_light_vectors[light_index++] = position - light_position;
+            }
+
             void LightingSystem::SetAmbientLightColor(RGBColor ambient_light_color)
             {
                 this->ambient_light_color = ambient_light_color;
+                change_count++;
+            }
+
+            void LightingSystem::SetShadowsEnabled(bool shadows_enabled)
+            {
+                light_table.shadows_enabled = shadows_enabled;
+                change_count++;
             }
 
             RGBColor LightingSystem::GetAmbientLightColor() const
@@ -51,44 +101,170 @@ namespace Engine
                 return GetLitColorAt(vertex.GetPosition(), vertex.GetNormal(), cam_pos, vertex_position_lights, material_properties);
             }
 
-            RGBColor LightingSystem::GetLitColorAt(const Vector3& position, const Vector3& normal, const Vector3& cam_pos, const Vector3 position_lights[], const MaterialProperties& material_properties) const
+            bool LightingSystem::IsInShadow(int32_t shadow_index, const Vector3 position_lights[]) const
+            {
+                if (shadow_index < 0)
+                    return false;
+
+                const Vector3& position_light    = position_lights[shadow_index];
+                const LightShadowMap& shadow_map = light_table.shadow_maps[shadow_index];
+
+                // out of light's view range (outside the NDC coords from its perspective)
+                if (!Util::IsInRange<float>(position_light.x, -1.0f, 1.0f) || !Util::IsInRange<float>(position_light.y, -1.0f, 1.0f))
+                    return false;
+
+                uint16_t depthbuffer_x = (uint16_t)Util::Lerp(position_light.x, -1, 1, 0, 200);
+                uint16_t depthbuffer_y = (uint16_t)Util::Lerp(position_light.y, 1, -1, 0, 200);
+
+                float light_depth = shadow_map.depthbuffer->GetValue(depthbuffer_x, depthbuffer_y);
+
+                return !(position_light.z < (light_depth + shadow_map.bias));
+            }
+
+            float LightingSystem::GetAttenuationAmount(const Attenuation& attenuation, float light_dist)
+            {
+                return 1.0f / (attenuation.c + attenuation.b * light_dist + attenuation.a * light_dist * light_dist + 0.0001f);
+            }
+
+            template<bool is_tangent_space>
+            RGBColor LightingSystem::GetLitColor(const Vector3& position,
+                                                 const Vector3& normal,
+                                                 const Vector3& view_dir,
+                                                 const Vector3 light_vectors[],
+                                                 const Vector3 position_lights[],
+                                                 const MaterialProperties& material_properties,
+                                                 RGBColor out_shadowed_colors[LightTable::max_shadow_maps]) const
             {
                 RGBColor final_color;
 
-                uint8_t i = 0;
-                for (std::shared_ptr<ILight> light : lights)
+                // the shadows are tested here, unless the lights with a shadow map are kept apart for the caller to test them
+                auto AddLightColor = [&](int32_t shadow_index, RGBColor light_color)
                 {
-                    if (!light->IsShadowCaster())
-                    {
-                        final_color += light->GetColorAt(position, normal, cam_pos, material_properties);
+                    if (out_shadowed_colors != nullptr && shadow_index >= 0)
+                        out_shadowed_colors[shadow_index] += light_color;
+                    else
+                        final_color += light_color;
+                };
 
+                for (size_t i = 0; i < light_table.directional_directions.size(); i++)
+                {
+                    if (out_shadowed_colors == nullptr && IsInShadow(light_table.directional_shadow_indices[i], position_lights))
                         continue;
-                    }
 
-                    const Vector3 position_light = position_lights[i++];
+                    Vector3 light_dir;
 
-                    // out of light's view range (outside the NDC coords from its perspective)
-                    if (!Util::IsInRange<float>(position_light.x, -1.0f, 1.0f) || !Util::IsInRange<float>(position_light.y, -1.0f, 1.0f))
-                    {
-                        final_color += light->GetColorAt(position, normal, cam_pos, material_properties);
+                    if constexpr (is_tangent_space)
+                        light_dir = light_vectors[i].GetFastNormalized();
+                    else
+                        light_dir = light_table.directional_directions[i];
 
+                    AddLightColor(light_table.directional_shadow_indices[i], light_table.directional_colors[i].GetBlendMultiplied(ILight::GetLightAmount(light_dir, normal, view_dir, 1.0f, material_properties)));
+                }
+
+                // only the point and spot lights binned in the position's cell can reach it
+                int32_t cluster = light_table.GetClusterIndex(position);
+
+                if (cluster < 0)
+                    return final_color;
+
+                // the light vectors are in the order of the whole table
+                size_t point_lights_start = light_table.directional_directions.size();
+                size_t spot_lights_start  = point_lights_start + light_table.point_positions.size();
+
+                for (uint32_t c = light_table.cluster_point_offsets[cluster]; c < light_table.cluster_point_offsets[cluster + 1]; c++)
+                {
+                    uint32_t i = light_table.cluster_point_lights[c];
+
+                    Vector3 light_vector     = position - light_table.point_positions[i];
+                    float light_range        = light_table.point_ranges[i];
+                    float light_dist_squared = light_vector.GetLengthSquared();
+
+                    if (light_dist_squared > light_range * light_range)
+                        continue;
+
+                    // the distance and the direction both come from the inverse square root
+                    float inverse_light_dist = Util::FastRSqrt(light_dist_squared);
+                    float light_dist         = light_dist_squared * inverse_light_dist;
+
+                    Vector3 light_dir;
+
+                    if constexpr (is_tangent_space)
+                        light_dir = light_vectors[point_lights_start + i].GetFastNormalized();
+                    else
+                        light_dir = light_vector * inverse_light_dist;
+
+                    float attenuation = GetAttenuationAmount(light_table.point_attenuations[i], light_dist);
+
+                    final_color += light_table.point_colors[i].GetBlendMultiplied(ILight::GetLightAmount(light_dir, normal, view_dir, attenuation, material_properties));
+                }
+
+                for (uint32_t c = light_table.cluster_spot_offsets[cluster]; c < light_table.cluster_spot_offsets[cluster + 1]; c++)
+                {
+                    uint32_t i = light_table.cluster_spot_lights[c];
+
+                    Vector3 light_vector     = position - light_table.spot_positions[i];
+                    float light_range        = light_table.spot_ranges[i];
+                    float light_dist_squared = light_vector.GetLengthSquared();
+
+                    if (light_dist_squared > light_range * light_range)
                         continue;
-                    }
 
-                    uint16_t depthbuffer_x = (uint16_t)Util::Lerp(position_light.x, -1, 1, 0, 200);
-                    uint16_t depthbuffer_y = (uint16_t)Util::Lerp(position_light.y, 1, -1, 0, 200);
+                    float inverse_light_dist = Util::FastRSqrt(light_dist_squared);
+                    float light_dist         = light_dist_squared * inverse_light_dist;
+                    Vector3 world_light_dir  = light_vector * inverse_light_dist;
 
-                    float light_depth = light->GetLightDepthBuffer().value().get().GetValue(depthbuffer_x, depthbuffer_y);
+                    if (world_light_dir.GetDotProduct(light_table.spot_directions[i]) < light_table.spot_cos_angles[i])
+                        continue;
+
+                    if (out_shadowed_colors == nullptr && IsInShadow(light_table.spot_shadow_indices[i], position_lights))
+                        continue;
+
+                    Vector3 light_dir;
+
+                    if constexpr (is_tangent_space)
+                        light_dir = light_vectors[spot_lights_start + i].GetFastNormalized();
+                    else
+                        light_dir = world_light_dir;
 
-                    if (position_light.z < (light_depth + light->GetBias().value()))
-                        final_color += light->GetColorAt(position, normal, cam_pos, material_properties);
+                    float attenuation = GetAttenuationAmount(light_table.spot_attenuations[i], light_dist);
+
+                    AddLightColor(light_table.spot_shadow_indices[i], light_table.spot_colors[i].GetBlendMultiplied(ILight::GetLightAmount(light_dir, normal, view_dir, attenuation, material_properties)));
                 }
 
                 return final_color;
             }
 
+            RGBColor LightingSystem::GetLitColorAt(const Vector3& position, const Vector3& normal, const Vector3& cam_pos, const Vector3 position_lights[], const MaterialProperties& material_properties) const
+            {
+                return GetLitColor<false>(position, normal, cam_pos - position, nullptr, position_lights, material_properties, nullptr);
+            }
+
+            RGBColor LightingSystem::GetLitColorAt(const Vector3& position,
+                                                   const Vector3& normal,
+                                                   const Vector3 light_vectors[],
+                                                   const Vector3& view_vector,
+                                                   const Vector3 position_lights[],
+                                                   const MaterialProperties& material_properties) const
+            {
+                return GetLitColor<true>(position, normal, view_vector, light_vectors, position_lights, material_properties, nullptr);
+            }
+
+            RGBColor LightingSystem::GetUnshadowedLitColorAt(const Vector3& position,
+                                                             const Vector3& normal,
+                                                             const Vector3& cam_pos,
+                                                             const MaterialProperties& material_properties,
+                                                             RGBColor out_shadowed_colors[LightTable::max_shadow_maps]) const
+            {
+                std::fill_n(out_shadowed_colors, light_table.shadow_maps.size(), RGBColor(0, 0, 0));
+
+                return GetLitColor<false>(position, normal, cam_pos - position, nullptr, nullptr, material_properties, out_shadowed_colors);
+            }
+
             void LightingSystem::ClearDepthBuffers()
             {
+                if (!light_table.shadows_enabled)
+                    return;
+
                 for (std::shared_ptr<ILight> light : lights)
                 {
                     if (!light->IsShadowCaster() || !light->GetLightDepthBuffer().has_value())
@@ -2,6 +2,7 @@
 #define LIGHTINGSYSTEM_HPP
 
 #include "ILight.hpp"
+#include "LightTable.hpp"
 
 #include "Display/RGBColor.hpp"
 #include "Engine/Rendering/DepthBuffer.hpp"
@@ -27,6 +28,22 @@ namespace Engine
             private:
                 RGBColor ambient_light_color;
                 std::vector<std::shared_ptr<ILight>> lights;
+                LightTable light_table;
+                // the changes to the lights that are no longer in the system are kept in here, so the total never goes back
+                uint32_t change_count = 0;
+
+                [[nodiscard]] static inline float GetAttenuationAmount(const Attenuation& attenuation, float light_dist);
+
+                // the light vectors are only used in tangent space, in world space they're taken from the light table, the position in the lights is not
+                // used when the shadowed colors are given
+                template<bool is_tangent_space>
+                [[nodiscard]] RGBColor GetLitColor(const Vector3& position,
+                                                   const Vector3& normal,
+                                                   const Vector3& view_dir,
+                                                   const Vector3 light_vectors[],
+                                                   const Vector3 position_lights[],
+                                                   const MaterialProperties& material_properties,
+                                                   RGBColor out_shadowed_colors[LightTable::max_shadow_maps]) const;
 
             public:
                 LightingSystem();
@@ -35,13 +52,42 @@ namespace Engine
                 void RemoveLight(int index);
 
                 void SetAmbientLightColor(RGBColor color);
+                // the shadow casters are lit without their shadow maps, which are then neither rendered nor cleared
+                void SetShadowsEnabled(bool shadows_enabled);
 
                 [[nodiscard]] RGBColor GetAmbientLightColor() const;
 
-                const std::vector<std::shared_ptr<ILight>> GetLights() const;
+                [[nodiscard]] const std::vector<std::shared_ptr<ILight>>& GetLights() const;
+                // goes up whenever a light is set, added or removed, or the ambient light or the shadows change
+                [[nodiscard]] uint32_t GetChangeCount() const;
+
+                // flattens the lights as they are now, the renderers do it once per frame before anything is lit
+                void UpdateLightTable();
+                [[nodiscard]] const LightTable& GetLightTable() const;
+                // the vectors from each light in the table to the position, not normalized
+                void GetLightVectorsAt(const Vector3& position, Vector3 out_light_vectors[]) const;
 
                 [[nodiscard]] RGBColor GetLitColorAt(const Vertex& vertex, const Vector3& cam_pos, const Vector3 vertex_position_lights[], const MaterialProperties& material_properties) const;
                 [[nodiscard]] RGBColor GetLitColorAt(const Vector3& position, const Vector3& normal, const Vector3& cam_pos, const Vector3 position_lights[], const MaterialProperties& material_properties) const;
+                // the normal, the light vectors (one per light, in the order of the light table) and the view vector are in tangent space, the position is
+                // still in world space for the attenuation and the shadows
+                [[nodiscard]] RGBColor GetLitColorAt(const Vector3& position,
+                                                     const Vector3& normal,
+                                                     const Vector3 light_vectors[],
+                                                     const Vector3& view_vector,
+                                                     const Vector3 position_lights[],
+                                                     const MaterialProperties& material_properties) const;
+
+                // the lights with a shadow map are left out of the color and added to out_shadowed_colors at their shadow index instead, so the shadows
+                // can be tested somewhere other than where the lighting is done
+                [[nodiscard]] RGBColor GetUnshadowedLitColorAt(const Vector3& position,
+                                                               const Vector3& normal,
+                                                               const Vector3& cam_pos,
+                                                               const MaterialProperties& material_properties,
+                                                               RGBColor out_shadowed_colors[LightTable::max_shadow_maps]) const;
+
+                // the position is in the light's NDC space, lights without a shadow index never are
+                [[nodiscard]] bool IsInShadow(int32_t shadow_index, const Vector3 position_lights[]) const;
 
                 void ClearDepthBuffers();
             };
@@ -1,19 +1,47 @@
 #ifndef MATERIALPROPERTIES_HPP
 #define MATERIALPROPERTIES_HPP
 
+#include "Math/Util/FastMath.hpp"
+
+#include <memory>
+
 namespace Engine
 {
     namespace Rendering
     {
         namespace Lighting
         {
-            struct MaterialProperties
+            class MaterialProperties
             {
+            private:
+                // only set by the constructor, so the table always matches them
                 float specular_factor;
                 float specular_intensity;
+                // the specular factor sampled for the highlights, shared by the copies of the material, materials without a highlight don't have one
+                std::shared_ptr<const Math::Util::PowTable<>> specular_table;
+
+            public:
+                MaterialProperties(float specular_factor = 1.0f, float specular_intensity = 0.0f) :
+                    specular_factor(specular_factor),
+                    specular_intensity(specular_intensity),
+                    specular_table(specular_intensity > 0.0f ? std::make_shared<const Math::Util::PowTable<>>(specular_factor) : nullptr)
+                {
+                }
+
+                [[nodiscard]] float GetSpecularFactor() const
+                {
+                    return specular_factor;
+                }
+
+                [[nodiscard]] float GetSpecularIntensity() const
+                {
+                    return specular_intensity;
+                }
 
-                MaterialProperties(float specular_factor = 1.0f, float specular_intensity = 0.0f) : specular_factor(specular_factor), specular_intensity(specular_intensity)
+                // nullptr without a highlight
+                [[nodiscard]] const Math::Util::PowTable<>* GetSpecularTable() const
                 {
+                    return specular_table.get();
                 }
             };
         }
@@ -1,5 +1,6 @@
 #include "PointLight.hpp"
 
+#include "LightTable.hpp"
 #include "Math/Matrix4.hpp"
 #include "Math/Vector3.hpp"
 
@@ -27,6 +28,7 @@ namespace Engine
             void PointLight::SetPosition(const Vector3& position)
             {
                 this->position = position;
+                change_count++;
             }
 
             float PointLight::GetRange() const
@@ -37,6 +39,7 @@ namespace Engine
             void PointLight::SetRange(float range)
             {
                 this->range = range;
+                change_count++;
             }
 
             RGBColor PointLight::GetColor() const
@@ -47,27 +50,24 @@ namespace Engine
             void PointLight::SetColor(RGBColor color)
             {
                 this->color = color;
+                change_count++;
             }
 
-            RGBColor PointLight::GetColorAt(const Vector3& position, const Vector3& normal, const Vector3& cam_pos, const MaterialProperties& material_properties) const
+            float PointLight::GetAttenuationAt(const Vector3& position, Vector3& out_light_vector) const
             {
-                Vector3 light_dir = position - this->position;
-                float light_dist  = light_dir.GetLength();
+                out_light_vector = position - this->position;
 
-                if (light_dist > range)
-                    return RGBColor(0, 0, 0);
+                if (out_light_vector.GetLengthSquared() > range * range)
+                    return 0.0f;
 
-                light_dir.Normalize();
+                float light_dist = out_light_vector.GetLength();
 
-                float attenuation_amount = attenuation.c + attenuation.b * light_dist + attenuation.a * light_dist * light_dist + 0.0001f;
-
-                float amount = normal.GetDotProduct(-light_dir);
-
-                amount /= attenuation_amount;
-                amount += GetSpecularHighlightAt(position, normal, cam_pos, light_dir, material_properties);
-                amount = std::clamp(amount, 0.0f, 1.0f);
+                return 1.0f / (attenuation.c + attenuation.b * light_dist + attenuation.a * light_dist * light_dist + 0.0001f);
+            }
 
-                return color.GetBlendMultiplied(amount);
+            void PointLight::AddToLightTable(LightTable& light_table)
+            {
+                light_table.AddPointLight(position, range, attenuation, color);
             }
 
             bool PointLight::IsShadowCaster() const
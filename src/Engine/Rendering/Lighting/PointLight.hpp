@@ -35,7 +35,8 @@ namespace Engine
                 [[nodiscard]] float GetRange() const;
                 void SetRange(float range);
 
-                virtual RGBColor GetColorAt(const Vector3& position, const Vector3& normal, const Vector3& cam_pos, const MaterialProperties& material_properties) const override;
+                virtual float GetAttenuationAt(const Vector3& position, Vector3& out_light_vector) const override;
+                virtual void AddToLightTable(LightTable& light_table) override;
 
                 virtual bool IsShadowCaster() const override;
 
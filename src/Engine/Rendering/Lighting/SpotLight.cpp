@@ -1,6 +1,7 @@
 #include "SpotLight.hpp"
 
 #include "Engine/Rendering/Transform.hpp"
+#include "LightTable.hpp"
 #include "Math/Matrix4.hpp"
 #include "Math/Util/MathUtil.hpp"
 #include "Math/Vector3.hpp"
@@ -54,6 +55,7 @@ namespace Engine
             void SpotLight::SetPosition(const Vector3& position)
             {
                 this->position = position;
+                change_count++;
 
                 UpdateViewMatrix();
             }
@@ -65,6 +67,7 @@ namespace Engine
             void SpotLight::SetDirection(const Vector3& direction)
             {
                 this->direction = direction;
+                change_count++;
 
                 UpdateViewMatrix();
             }
@@ -77,6 +80,7 @@ namespace Engine
             void SpotLight::SetAngle(float angle)
             {
                 this->angle = angle;
+                change_count++;
             }
 
             float SpotLight::GetRange() const
@@ -87,6 +91,7 @@ namespace Engine
             void SpotLight::SetRange(float range)
             {
                 this->range = range;
+                change_count++;
             }
 
             RGBColor SpotLight::GetColor() const
@@ -97,34 +102,33 @@ namespace Engine
             void SpotLight::SetColor(RGBColor color)
             {
                 this->color = color;
+                change_count++;
             }
 
-            RGBColor SpotLight::GetColorAt(const Vector3& position, const Vector3& normal, const Vector3& cam_pos, const MaterialProperties& material_properties) const
+            float SpotLight::GetAttenuationAt(const Vector3& position, Vector3& out_light_vector) const
             {
-                Vector3 light_dir = position - this->position;
-                float light_dist  = light_dir.GetLength();
+                out_light_vector = position - this->position;
 
-                if (light_dist > range)
-                    return RGBColor(0, 0, 0);
+                if (out_light_vector.GetLengthSquared() > range * range)
+                    return 0.0f;
 
-                light_dir.Normalize();
+                float light_dist = out_light_vector.GetLength();
 
-                float spotfactor = light_dir.GetDotProduct(direction);
+                float spotfactor = out_light_vector.GetNormalized().GetDotProduct(direction);
 
                 float ang = Math::Util::ToDegrees(std::acos(static_cast<float>(spotfactor)));
 
                 if (ang > angle)
-                    return RGBColor(0, 0, 0);
+                    return 0.0f;
 
-                float attenuation_amount = attenuation.c + attenuation.b * light_dist + attenuation.a * light_dist * light_dist + 0.0001f;
-
-                float amount = normal.GetDotProduct(-light_dir);
+                return 1.0f / (attenuation.c + attenuation.b * light_dist + attenuation.a * light_dist * light_dist + 0.0001f);
+            }
 
-                amount /= attenuation_amount;
-                amount += GetSpecularHighlightAt(position, normal, cam_pos, light_dir, material_properties);
-                amount = std::clamp(amount, 0.0f, 1.0f);
+            void SpotLight::AddToLightTable(LightTable& light_table)
+            {
+                int32_t shadow_index = light_table.AddShadowMap({position, &view_mat, &projection_mat, &depthbuffer, GetBias().value(), IsLinearProjection().value()});
 
-                return color.GetBlendMultiplied(amount);
+                light_table.AddSpotLight(position, direction, range, angle, attenuation, color, shadow_index);
             }
 
             bool SpotLight::IsShadowCaster() const
@@ -0,0 +1,68 @@
+#include "MeshInstance.hpp"
+
+namespace Engine
+{
+    namespace Rendering
+    {
+        MeshInstance::MeshInstance() : color(RGBColor(255, 255, 255)), transform(Transform()), material_properties(MaterialProperties())
+        {
+        }
+
+        RGBColor MeshInstance::GetColor() const
+        {
+            return color;
+        }
+
+        const Transform& MeshInstance::GetTransform() const
+        {
+            return transform;
+        }
+
+        const MaterialProperties& MeshInstance::GetMaterialProperties() const
+        {
+            return material_properties;
+        }
+
+        uint32_t MeshInstance::GetChangeCount() const
+        {
+            return change_count + transform.GetChangeCount();
+        }
+
+        MeshInstance& MeshInstance::SetColor(const RGBColor& color)
+        {
+            this->color = color;
+            change_count++;
+
+            return *this;
+        }
+
+        MeshInstance& MeshInstance::SetPosition(const Vector3& position)
+        {
+            transform.SetTranslation(position);
+
+            return *this;
+        }
+
+        MeshInstance& MeshInstance::SetRotation(const Angle& rotation)
+        {
+            transform.SetRotation(rotation);
+
+            return *this;
+        }
+
+        MeshInstance& MeshInstance::SetScale(const Vector3& scale)
+        {
+            transform.SetScale(scale);
+
+            return *this;
+        }
+
+        MeshInstance& MeshInstance::SetMaterialProperties(const MaterialProperties& material_properties)
+        {
+            this->material_properties = material_properties;
+            change_count++;
+
+            return *this;
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef MESHINSTANCE_HPP
+#define MESHINSTANCE_HPP
+
+#include "Display/RGBColor.hpp"
+#include "Lighting/MaterialProperties.hpp"
+#include "Math/Angle.hpp"
+#include "Math/Vector3.hpp"
+#include "Transform.hpp"
+
+#include <cstdint>
+
+namespace Engine
+{
+    namespace Rendering
+    {
+        using namespace Display;
+        using namespace Math;
+        using namespace Lighting;
+
+        // the per instance state of an instanced draw, everything that is shared between the instances (model, textures) comes from the mesh it is drawn with
+        class MeshInstance
+        {
+        private:
+            RGBColor color;
+
+            Transform transform;
+
+            MaterialProperties material_properties;
+
+            // the sets of the color and material, the transform counts it's own
+            uint32_t change_count = 0;
+
+        public:
+            MeshInstance();
+
+            [[nodiscard]] RGBColor GetColor() const;
+            [[nodiscard]] const Transform& GetTransform() const;
+            [[nodiscard]] const MaterialProperties& GetMaterialProperties() const;
+            [[nodiscard]] uint32_t GetChangeCount() const;
+
+            MeshInstance& SetColor(const RGBColor& color);
+            MeshInstance& SetPosition(const Vector3& position);
+            MeshInstance& SetRotation(const Angle& rotation);
+            MeshInstance& SetScale(const Vector3& scale);
+            MeshInstance& SetMaterialProperties(const MaterialProperties& material_properties);
+        };
+    }
+}
+
+#endif
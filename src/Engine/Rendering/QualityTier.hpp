@@ -0,0 +1,17 @@
+#ifndef QUALITYTIER_HPP
+#define QUALITYTIER_HPP
+
+namespace Engine
+{
+    namespace Rendering
+    {
+        // a feature a renderer can give up to render faster, the renderers declare theirs in the order they are given up, the one that costs the
+        // least to lose first, so a quality level n means the first n tiers are given up
+        struct QualityTier
+        {
+            const char* name;
+        };
+    }
+}
+
+#endif
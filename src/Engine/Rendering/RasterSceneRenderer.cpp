@@ -1,8 +1,13 @@
 #include "RasterSceneRenderer.hpp"
 
 #include "AnimatedMesh.hpp"
+#include "Math/Util/MathUtil.hpp"
 #include "TextureConstants.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace Engine
 {
     namespace Rendering
@@ -13,7 +18,8 @@ namespace Engine
             shadowmap_rasterizer(),
             resource_manager(std::move(resource_manager)),
             lighting_system(std::move(lighting_system)),
-            camera(std::move(camera))
+            camera(std::move(camera)),
+            lod_enabled(true)
         {
             shadowmap_rasterizer.SetFrameDrawer(this->null_frame_drawer);
 
@@ -28,6 +34,51 @@ namespace Engine
             rasterizer.SetFrameDrawer(this->frame_drawer);
         }
 
+        void RasterSceneRenderer::SetLodEnabled(bool lod_enabled)
+        {
+            this->lod_enabled = lod_enabled;
+        }
+
+        void RasterSceneRenderer::SetTangentSpaceLightingEnabled(bool tangent_space_lighting_enabled)
+        {
+            shader_shaded.SetTangentSpaceLighting(tangent_space_lighting_enabled);
+        }
+
+        void RasterSceneRenderer::SetShadingOptions(ShadingOptions shading_options)
+        {
+            this->shading_options = shading_options;
+
+            shader_shaded.SetShadingOptions(IsTierGivenUp(per_pixel_lighting_tier) ? ShadingOptions::PER_VERTEX : shading_options);
+        }
+
+        void RasterSceneRenderer::SetPerPixelShadowsEnabled(bool per_pixel_shadows_enabled)
+        {
+            shader_shaded.SetPerPixelShadows(per_pixel_shadows_enabled);
+        }
+
+        void RasterSceneRenderer::SetQualityLevel(uint8_t quality_level)
+        {
+            this->quality_level = quality_level;
+
+            SetShadingOptions(shading_options);
+            lighting_system->SetShadowsEnabled(!IsTierGivenUp(shadows_tier));
+        }
+
+        bool RasterSceneRenderer::IsTierGivenUp(uint8_t tier) const
+        {
+            return tier < quality_level;
+        }
+
+        void RasterSceneRenderer::SetShaderNormalMap(const std::string& normal_map_resource)
+        {
+            std::optional<std::shared_ptr<Texture>> normal_map = resource_manager->GetLoadedTexture(normal_map_resource);
+
+            if (normal_map.has_value() && !IsTierGivenUp(normal_maps_tier))
+                shader_shaded.SetNormalMap(normal_map.value());
+            else
+                shader_shaded.DisableNormalMap();
+        }
+
         void RasterSceneRenderer::DrawMesh(AbstractMesh& mesh)
         {
             render_buffer_plain.push_back(std::reference_wrapper(mesh));
@@ -44,10 +95,85 @@ namespace Engine
                 updatable_animated_meshes.push_back(std::reference_wrapper(dynamic_cast<AnimatedMesh&>(mesh)));
         }
 
+        void RasterSceneRenderer::DrawMeshInstanced(AbstractMesh& mesh, std::span<const MeshInstance> instances)
+        {
+            render_buffer_plain_instanced.push_back({std::reference_wrapper(mesh), instances});
+
+            if (mesh.IsAnimated())
+                updatable_animated_meshes.push_back(std::reference_wrapper(dynamic_cast<AnimatedMesh&>(mesh)));
+        }
+
+        void RasterSceneRenderer::DrawShadedMeshInstanced(AbstractMesh& mesh, std::span<const MeshInstance> instances)
+        {
+            render_buffer_shaded_instanced.push_back({std::reference_wrapper(mesh), instances});
+
+            if (mesh.IsAnimated())
+                updatable_animated_meshes.push_back(std::reference_wrapper(dynamic_cast<AnimatedMesh&>(mesh)));
+        }
+
+        uint32_t RasterSceneRenderer::GetTriangleBudget(const Transform& transform, float bounding_radius) const
+        {
+            float radius   = bounding_radius * transform.GetMaxScale();
+            float distance = camera->GetPosition().GetDistanceTo(transform.GetTranslation());
+
+            // the camera is inside the bounds, the mesh can cover the whole screen
+            if (distance <= radius)
+                return std::numeric_limits<uint32_t>::max();
+
+            // the radius in pixels, with the same vertical field of view as the projection matrix
+            float projected_radius = (radius / (distance * std::tan(Util::ToRadians(camera->GetFOV()) / 2.0f))) * ((float)camera->GetHeight() / 2.0f);
+            float projected_area   = PI * projected_radius * projected_radius;
+
+            return (uint32_t)std::min(projected_area * lod_triangles_per_pixel, (float)std::numeric_limits<uint32_t>::max());
+        }
+
+        uint32_t RasterSceneRenderer::SelectMeshLod(AbstractMesh& mesh, const Transform& transform) const
+        {
+            if (!lod_enabled)
+                return 0;
+
+            if (!mesh.IsAnimated())
+            {
+                std::shared_ptr<StaticModel> model = resource_manager->GetLoadedStaticModel(mesh.GetModelResource()).value();
+
+                if (model->GetLodCount() == 1)
+                    return 0;
+
+                return model->GetLodForTriangleBudget(GetTriangleBudget(transform, model->GetBoundingRadius()));
+            }
+
+            std::shared_ptr<AnimatedModel> model = resource_manager->GetLoadedAnimatedModel(mesh.GetModelResource()).value();
+
+            if (model->GetLodCount() == 1)
+                return 0;
+
+            return model->GetLodForTriangleBudget(GetTriangleBudget(transform, model->GetBoundingRadius()));
+        }
+
+        VertexBuffer RasterSceneRenderer::GetMeshVertexBuffer(AbstractMesh& mesh, uint32_t lod)
+        {
+            if (!mesh.IsAnimated())
+                return resource_manager->GetLoadedStaticModel(mesh.GetModelResource()).value()->GetVertexBuffer(lod);
+
+            AnimatedMesh& animated_mesh = dynamic_cast<AnimatedMesh&>(mesh);
+
+            return resource_manager->GetLoadedAnimatedModel(mesh.GetModelResource()).value()->GetVertexBuffer(animated_mesh.GetCurrentAnimationName(), animated_mesh.GetCurrentAnimationProgress(), lod);
+        }
+
+        const VertexBuffer& RasterSceneRenderer::GetMeshVertexBuffer(AbstractMesh& mesh, const Transform& transform, std::map<uint32_t, VertexBuffer>& lod_vertex_buffers)
+        {
+            uint32_t lod = SelectMeshLod(mesh, transform);
+
+            if (lod_vertex_buffers.find(lod) == lod_vertex_buffers.end())
+                lod_vertex_buffers.emplace(lod, GetMeshVertexBuffer(mesh, lod));
+
+            return lod_vertex_buffers.at(lod);
+        }
+
         void RasterSceneRenderer::RenderStaticMesh(Rasterizer& rasterizer, AbstractMesh& mesh, DepthBuffer& depthbuffer, IShader& shader, const RGBColor& color)
         {
             rasterizer.SetModelMatrix(mesh.GetTransform());
-            rasterizer.DrawVertexBuffer(depthbuffer, resource_manager->GetLoadedStaticModel(mesh.GetModelResource()).value()->GetVertexBuffer(), color, shader);
+            rasterizer.DrawVertexBuffer(depthbuffer, GetMeshVertexBuffer(mesh, SelectMeshLod(mesh, mesh.GetTransform())), color, shader);
         }
 
         void RasterSceneRenderer::RenderAnimatedMesh(Rasterizer& rasterizer, AbstractMesh& mesh, DepthBuffer& depthbuffer, IShader& shader, const RGBColor& color)
@@ -55,10 +181,7 @@ namespace Engine
             AnimatedMesh& animated_mesh = dynamic_cast<AnimatedMesh&>(mesh);
 
             rasterizer.SetModelMatrix(mesh.GetTransform());
-            rasterizer.DrawVertexBuffer(depthbuffer,
-                                        resource_manager->GetLoadedAnimatedModel(mesh.GetModelResource()).value()->GetVertexBuffer(animated_mesh.GetCurrentAnimationName(), animated_mesh.GetCurrentAnimationProgress()),
-                                        color,
-                                        shader);
+            rasterizer.DrawVertexBuffer(depthbuffer, GetMeshVertexBuffer(mesh, SelectMeshLod(mesh, mesh.GetTransform())), color, shader);
 
             animated_mesh.UpdateAnimation();
         }
@@ -71,23 +194,38 @@ namespace Engine
                 RenderStaticMesh(rasterizer, mesh, depthbuffer, shader, color);
         }
 
-        void RasterSceneRenderer::RenderShadowMapPass()
+        void RasterSceneRenderer::RenderMeshInstanced(Rasterizer& rasterizer, const InstancedMesh& instanced_mesh, DepthBuffer& depthbuffer, IShader& shader)
         {
-            for (std::shared_ptr<ILight> light : lighting_system->GetLights())
+            // the model lookup (and the interpolation for animated models) is done once per level of detail for all the instances
+            std::map<uint32_t, VertexBuffer> lod_vertex_buffers;
+
+            for (const MeshInstance& instance : instanced_mesh.instances)
             {
-                if (!light->IsShadowCaster())
-                    continue;
+                rasterizer.SetModelMatrix(instance.GetTransform());
+                rasterizer.DrawVertexBuffer(depthbuffer, GetMeshVertexBuffer(instanced_mesh.mesh.get(), instance.GetTransform(), lod_vertex_buffers), instance.GetColor(), shader);
+            }
+        }
 
-                shadowmap_rasterizer.SetProjectionMatrix(light->GetProjectionMatrix().value());
-                shadowmap_rasterizer.SetViewMatrix(light->GetViewMatrix().value());
+        void RasterSceneRenderer::RenderShadowMapPass()
+        {
+            for (const LightShadowMap& shadow_map : lighting_system->GetLightTable().shadow_maps)
+            {
+                shadowmap_rasterizer.SetProjectionMatrix(*shadow_map.projection_mat);
+                shadowmap_rasterizer.SetViewMatrix(*shadow_map.view_mat);
 
                 static const RGBColor nocolor;
 
                 for (std::reference_wrapper<AbstractMesh> mesh : render_buffer_plain)
-                    RenderMesh(shadowmap_rasterizer, mesh.get(), light->GetLightDepthBuffer().value(), shader_depthmap, nocolor);
+                    RenderMesh(shadowmap_rasterizer, mesh.get(), *shadow_map.depthbuffer, shader_depthmap, nocolor);
 
                 for (std::reference_wrapper<AbstractMesh> mesh : render_buffer_shaded)
-                    RenderMesh(shadowmap_rasterizer, mesh.get(), light->GetLightDepthBuffer().value(), shader_depthmap, nocolor);
+                    RenderMesh(shadowmap_rasterizer, mesh.get(), *shadow_map.depthbuffer, shader_depthmap, nocolor);
+
+                for (const InstancedMesh& instanced_mesh : render_buffer_plain_instanced)
+                    RenderMeshInstanced(shadowmap_rasterizer, instanced_mesh, *shadow_map.depthbuffer, shader_depthmap);
+
+                for (const InstancedMesh& instanced_mesh : render_buffer_shaded_instanced)
+                    RenderMeshInstanced(shadowmap_rasterizer, instanced_mesh, *shadow_map.depthbuffer, shader_depthmap);
             }
         }
 
@@ -101,6 +239,9 @@ namespace Engine
 
         void RasterSceneRenderer::RenderSceneShared(int64_t delta)
         {
+            // the lights are flattened once, everything lit in this frame reads them from the table
+            lighting_system->UpdateLightTable();
+
             RenderShadowMapPass();
 
             rasterizer.SetViewMatrix(camera->GetViewMatrix());
@@ -116,27 +257,59 @@ namespace Engine
 
             for (std::reference_wrapper<AbstractMesh> mesh : render_buffer_shaded)
             {
-                std::optional<std::shared_ptr<Texture>> texture    = resource_manager->GetLoadedTexture(mesh.get().GetTextureResource());
-                std::optional<std::shared_ptr<Texture>> normal_map = resource_manager->GetLoadedTexture(mesh.get().GetNormalMapResource());
+                std::optional<std::shared_ptr<Texture>> texture = resource_manager->GetLoadedTexture(mesh.get().GetTextureResource());
 
                 shader_shaded.SetTexture(texture.value_or(TextureConstants::White()));
                 shader_shaded.SetCameraPosition(camera->GetPosition());
                 shader_shaded.SetMaterialProperties(mesh.get().GetMaterialProperties());
-                if (normal_map.has_value())
-                    shader_shaded.SetNormalMap(normal_map.value());
-                else
-                    shader_shaded.DisableNormalMap();
+                SetShaderNormalMap(mesh.get().GetNormalMapResource());
 
                 RenderMesh(rasterizer, mesh.get(), camera->GetDepthBuffer(), shader_shaded, mesh.get().GetColor());
             }
 
+            for (const InstancedMesh& instanced_mesh : render_buffer_plain_instanced)
+            {
+                std::optional<std::shared_ptr<Texture>> texture = resource_manager->GetLoadedTexture(instanced_mesh.mesh.get().GetTextureResource());
+
+                shader_plain.SetTexture(texture.value_or(TextureConstants::White()));
+
+                RenderMeshInstanced(rasterizer, instanced_mesh, camera->GetDepthBuffer(), shader_plain);
+            }
+
+            for (const InstancedMesh& instanced_mesh : render_buffer_shaded_instanced)
+            {
+                AbstractMesh& mesh = instanced_mesh.mesh.get();
+
+                std::optional<std::shared_ptr<Texture>> texture = resource_manager->GetLoadedTexture(mesh.GetTextureResource());
+
+                shader_shaded.SetTexture(texture.value_or(TextureConstants::White()));
+                shader_shaded.SetCameraPosition(camera->GetPosition());
+                SetShaderNormalMap(mesh.GetNormalMapResource());
+
+                std::map<uint32_t, VertexBuffer> lod_vertex_buffers;
+
+                // only the material, color and model matrix (and maybe the level of detail) change between instances
+                for (const MeshInstance& instance : instanced_mesh.instances)
+                {
+                    shader_shaded.SetMaterialProperties(instance.GetMaterialProperties());
+
+                    rasterizer.SetModelMatrix(instance.GetTransform());
+                    rasterizer.DrawVertexBuffer(camera->GetDepthBuffer(), GetMeshVertexBuffer(mesh, instance.GetTransform(), lod_vertex_buffers), instance.GetColor(), shader_shaded);
+                }
+            }
+
             for (std::reference_wrapper<AnimatedMesh> mesh : updatable_animated_meshes)
             {
                 mesh.get().UpdateAnimation();
             }
 
+            // the poses interpolated in this frame are only shared in it
+            resource_manager->ClearAnimationPoseCaches();
+
             render_buffer_plain.clear();
             render_buffer_shaded.clear();
+            render_buffer_plain_instanced.clear();
+            render_buffer_shaded_instanced.clear();
             updatable_animated_meshes.clear();
         }
 
@@ -9,14 +9,19 @@
 #include "Display/RGBColor.hpp"
 #include "Engine/Resources/ResourceManager.hpp"
 #include "Lighting/LightingSystem.hpp"
+#include "MeshInstance.hpp"
+#include "QualityTier.hpp"
 #include "Rasterizer.hpp"
 #include "Shaders/DepthMapShader.hpp"
 #include "Shaders/PlainShader.hpp"
 #include "Shaders/ShadedShader.hpp"
 
+#include <array>
 #include <functional>
 #include <list>
+#include <map>
 #include <memory>
+#include <span>
 
 namespace Engine
 {
@@ -26,6 +31,13 @@ namespace Engine
         using namespace Resources;
         using namespace Lighting;
 
+        // a mesh drawn once per instance, the mesh provides the shared resources and the instances their own transform, color and material
+        struct InstancedMesh
+        {
+            std::reference_wrapper<AbstractMesh> mesh;
+            std::span<const MeshInstance> instances;
+        };
+
         class RasterSceneRenderer
         {
         private:
@@ -44,9 +56,27 @@ namespace Engine
 
             std::list<std::reference_wrapper<AbstractMesh>> render_buffer_plain;
             std::list<std::reference_wrapper<AbstractMesh>> render_buffer_shaded;
+            std::list<InstancedMesh> render_buffer_plain_instanced;
+            std::list<InstancedMesh> render_buffer_shaded_instanced;
 
             std::list<std::reference_wrapper<AnimatedMesh>> updatable_animated_meshes;
 
+            // meshes use simpler levels of detail when they are small on screen
+            bool lod_enabled;
+            // how many triangles a mesh can have per pixel it covers, about half of them are backfaces
+            static constexpr float lod_triangles_per_pixel = 1.0f;
+
+            // the shading that was asked for, a quality level can light per vertex regardless
+            ShadingOptions shading_options = ShadingOptions::PER_PIXEL;
+            uint8_t quality_level          = 0;
+
+            static constexpr uint8_t normal_maps_tier        = 0;
+            static constexpr uint8_t per_pixel_lighting_tier = 1;
+            static constexpr uint8_t shadows_tier            = 2;
+
+            [[nodiscard]] bool IsTierGivenUp(uint8_t tier) const;
+            void SetShaderNormalMap(const std::string& normal_map_resource);
+
             PlainShader shader_plain;
             ShadedShader shader_shaded;
             DepthMapShader shader_depthmap;
@@ -56,14 +86,36 @@ namespace Engine
             void RenderAnimatedMesh(Rasterizer& rasterizer, AbstractMesh& mesh, DepthBuffer& depthbuffer, IShader& shader, const RGBColor& color);
 
             void RenderMesh(Rasterizer& rasterizer, AbstractMesh& mesh, DepthBuffer& depthbuffer, IShader& shader, const RGBColor& color);
+            void RenderMeshInstanced(Rasterizer& rasterizer, const InstancedMesh& instanced_mesh, DepthBuffer& depthbuffer, IShader& shader);
+
+            [[nodiscard]] uint32_t GetTriangleBudget(const Transform& transform, float bounding_radius) const;
+            [[nodiscard]] uint32_t SelectMeshLod(AbstractMesh& mesh, const Transform& transform) const;
+
+            [[nodiscard]] VertexBuffer GetMeshVertexBuffer(AbstractMesh& mesh, uint32_t lod);
+            // the vertex buffer of each level is only fetched once, and reused for the next instances that need the same level
+            [[nodiscard]] const VertexBuffer& GetMeshVertexBuffer(AbstractMesh& mesh, const Transform& transform, std::map<uint32_t, VertexBuffer>& lod_vertex_buffers);
 
         public:
+            static constexpr std::array<QualityTier, 3> quality_tiers = {{{"normal maps"}, {"per pixel lighting"}, {"shadows"}}};
+
             RasterSceneRenderer(std::shared_ptr<ResourceManager> resource_manager, std::shared_ptr<LightingSystem> lighting_system, std::shared_ptr<Camera> camera);
 
             void SetFrameDrawer(std::shared_ptr<IFrameDrawer> frame_drawer);
+            void SetLodEnabled(bool lod_enabled);
+            // normal mapped meshes are lit in tangent space, with the light directions calculated per vertex
+            void SetTangentSpaceLightingEnabled(bool tangent_space_lighting_enabled);
+            // shaded meshes can be lit per vertex instead of per pixel, with the shadows still tested per pixel unless they're disabled too
+            void SetShadingOptions(ShadingOptions shading_options);
+            void SetPerPixelShadowsEnabled(bool per_pixel_shadows_enabled);
+            // gives up the first quality_level of the quality tiers, the shadows are given up in the lighting system so they're gone for every
+            // renderer that shares it
+            void SetQualityLevel(uint8_t quality_level);
 
             void DrawMesh(AbstractMesh& mesh);
             void DrawShadedMesh(AbstractMesh& mesh);
+            // the instances are not copied, they must be kept alive until the scene is rendered
+            void DrawMeshInstanced(AbstractMesh& mesh, std::span<const MeshInstance> instances);
+            void DrawShadedMeshInstanced(AbstractMesh& mesh, std::span<const MeshInstance> instances);
             void DrawPixel(uint16_t x, uint16_t y, const RGBColor& color);
 
             void RenderScene(int64_t delta);
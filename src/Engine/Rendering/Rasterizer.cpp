@@ -1,5 +1,6 @@
 #include "Rasterizer.hpp"
 
+#include "Engine/Kernels/RasterKernels.hpp"
 #include "Math/Vector2I.hpp"
 
 #include <algorithm>
@@ -136,35 +137,47 @@ namespace Engine
             if (area.edgefunction_res == 0)
                 return;
 
+            Triangle stepped_triangle = triangle;
+
+            stepped_triangle.barcoord0_dx = edge0.step_delta_x / (float)area.edgefunction_res;
+            stepped_triangle.barcoord1_dx = edge1.step_delta_x / (float)area.edgefunction_res;
+            stepped_triangle.barcoord0_dy = edge0.step_delta_y / (float)area.edgefunction_res;
+            stepped_triangle.barcoord1_dy = edge1.step_delta_y / (float)area.edgefunction_res;
+
+            const int32_t edge_steps_x[3] = {edge0.step_delta_x, edge1.step_delta_x, edge2.step_delta_x};
+            const int32_t row_width       = bbox_max.x - bbox_min.x + 1;
+
             for (uint16_t y = bbox_min.y; y <= bbox_max.y; y++)
             {
-                int32_t edge0_mag_xy = edge0.edgefunction_res;
-                int32_t edge1_mag_xy = edge1.edgefunction_res;
-                int32_t edge2_mag_xy = edge2.edgefunction_res;
+                const int32_t row_edge_values[3] = {edge0.edgefunction_res, edge1.edgefunction_res, edge2.edgefunction_res};
+
+                // only the pixels inside all the edges are visited, the kernel finds them a register of pixels at a time
+                int32_t span_start;
+                int32_t span_end;
+                Kernels::find_covered_span(row_edge_values, edge_steps_x, row_width, span_start, span_end);
 
-                for (uint16_t x = bbox_min.x; x <= bbox_max.x; x++)
+                int32_t edge0_mag_xy = edge0.edgefunction_res + edge0.step_delta_x * span_start;
+                int32_t edge1_mag_xy = edge1.edgefunction_res + edge1.step_delta_x * span_start;
+
+                for (uint16_t x = bbox_min.x + span_start; x < bbox_min.x + span_end; x++)
                 {
-                    if ((edge0_mag_xy | edge1_mag_xy | edge2_mag_xy) >= 0)
-                    {
-                        float barcoord0 = edge0_mag_xy / (float)area.edgefunction_res;
-                        float barcoord1 = edge1_mag_xy / (float)area.edgefunction_res;
-                        // the sum of the 3 barycentric coords is 1, this avoids a division
-                        float barcoord2 = 1.0f - (barcoord0 + barcoord1);
+                    float barcoord0 = edge0_mag_xy / (float)area.edgefunction_res;
+                    float barcoord1 = edge1_mag_xy / (float)area.edgefunction_res;
+                    // the sum of the 3 barycentric coords is 1, this avoids a division
+                    float barcoord2 = 1.0f - (barcoord0 + barcoord1);
 
-                        float z = barcoord0 * triangle.v0_screen.z + barcoord1 * triangle.v1_screen.z + barcoord2 * triangle.v2_screen.z;
+                    float z = barcoord0 * triangle.v0_screen.z + barcoord1 * triangle.v1_screen.z + barcoord2 * triangle.v2_screen.z;
 
-                        if (depthbuffer.GetValue(x, y) > z)
-                        {
-                            RGBColor out_color = shader.FragmentShader(color, triangle, barcoord0, barcoord1, barcoord2);
+                    if (depthbuffer.GetValue(x, y) > z)
+                    {
+                        RGBColor out_color = shader.FragmentShader(color, stepped_triangle, barcoord0, barcoord1, barcoord2);
 
-                            depthbuffer.SetValue(x, y, z);
-                            frame_drawer->SetPixel(x, y, out_color);
-                        }
+                        depthbuffer.SetValue(x, y, z);
+                        frame_drawer->SetPixel(x, y, out_color);
                     }
 
                     edge0_mag_xy += edge0.step_delta_x;
                     edge1_mag_xy += edge1.step_delta_x;
-                    edge2_mag_xy += edge2.step_delta_x;
                 }
 
                 edge0.edgefunction_res += edge0.step_delta_y;
@@ -34,7 +34,7 @@ namespace Engine
             vert *= inverse_view_mat;
             vert.PerspectiveDivide();
 
-            return Ray(origin, origin.GetDirectionalTo(vert.GetPosition()));
+            return Ray(origin, (vert.GetPosition() - origin).GetFastNormalized());
         }
 
         Ray RayMarcher::SetupRayOrtho(uint16_t x, uint16_t y) const
@@ -79,15 +79,12 @@ namespace Engine
         {
             uint8_t hit_ndc_light_space_c = 0;
 
-            for (std::shared_ptr<ILight> light : lighting_system.GetLights())
+            for (const LightShadowMap& shadow_map : lighting_system.GetLightTable().shadow_maps)
             {
-                if (!light->IsShadowCaster())
-                    continue;
-
                 // hack to do the 4d matrix mul and perspective divide (keeping the W component) without going for a concrete Vector4 class
                 Vertex vert = Vertex(hit_pos);
-                vert *= light->GetViewMatrix().value().get();
-                vert *= light->GetProjectionMatrix().value().get();
+                vert *= *shadow_map.view_mat;
+                vert *= *shadow_map.projection_mat;
                 vert.PerspectiveDivide();
 
                 hit_ndc_light_space[hit_ndc_light_space_c++] = vert.GetPosition();
@@ -98,15 +95,12 @@ namespace Engine
         {
             uint8_t hit_ndc_light_space_c = 0;
 
-            for (std::shared_ptr<ILight> light : lighting_system.GetLights())
+            for (const LightShadowMap& shadow_map : lighting_system.GetLightTable().shadow_maps)
             {
-                if (!light->IsShadowCaster())
-                    continue;
-
                 // hack to do the 4d matrix mul and perspective divide (keeping the W component) without going for a concrete Vector4 class
                 Vector3 hit_in_light_space = hit_pos;
-                hit_in_light_space *= light->GetViewMatrix().value().get();
-                hit_in_light_space *= light->GetProjectionMatrix().value().get();
+                hit_in_light_space *= *shadow_map.view_mat;
+                hit_in_light_space *= *shadow_map.projection_mat;
 
                 hit_ndc_light_space[hit_ndc_light_space_c++] = hit_in_light_space;
             }
@@ -120,7 +114,7 @@ namespace Engine
                 {
                     Ray ray = SetupRayPerspective(x, y, origin);
 
-                    MarchResult march_res = ray.MarchUntilHit(voxel_grid, 1000);
+                    MarchResult march_res = ray.MarchUntilHit(voxel_grid, max_iterations);
 
                     if (!march_res.did_hit)
                         continue;
@@ -141,7 +135,7 @@ namespace Engine
                 {
                     Ray ray = SetupRayOrtho(x, y);
 
-                    MarchResult march_res = ray.MarchUntilHit(voxel_grid, 1000);
+                    MarchResult march_res = ray.MarchUntilHit(voxel_grid, max_iterations);
 
                     if (!march_res.did_hit)
                         continue;
@@ -162,7 +156,7 @@ namespace Engine
                 {
                     Ray ray = SetupRayPerspective(x, y, origin);
 
-                    MarchResult march_res = ray.MarchUntilHit(voxel_grid, 1000);
+                    MarchResult march_res = ray.MarchUntilHit(voxel_grid, max_iterations);
 
                     if (!march_res.did_hit)
                         continue;
@@ -201,6 +195,11 @@ namespace Engine
             inverse_projection_mat = projection_mat.GetInverted();
         }
 
+        void RayMarcher::SetMaxIterations(uint16_t max_iterations)
+        {
+            this->max_iterations = max_iterations;
+        }
+
         void RayMarcher::DrawPixel(uint16_t x, uint16_t y, const RGBColor& color)
         {
             frame_drawer->SetPixel(x, y, color);
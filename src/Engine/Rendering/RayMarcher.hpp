@@ -32,7 +32,10 @@ namespace Engine
 
             std::shared_ptr<IFrameDrawer> frame_drawer;
 
-            Vector3 hit_ndc_light_space[10];
+            Vector3 hit_ndc_light_space[LightTable::max_shadow_maps];
+
+            // the cells a ray goes through before it gives up, which is how far it can see
+            uint16_t max_iterations = 1000;
 
             Ray SetupRayPerspective(uint16_t x, uint16_t y, const Vector3& origin) const;
             Ray SetupRayOrtho(uint16_t x, uint16_t y) const;
@@ -48,6 +51,7 @@ namespace Engine
 
             void SetViewMatrix(const Matrix4& view_matrix);
             void SetProjectionMatrix(const Matrix4& projection_matrix);
+            void SetMaxIterations(uint16_t max_iterations);
 
             void DrawVoxelGridDepthOnlyPerspective(DepthBuffer& depthbuffer, const VoxelGrid& voxel_grid, const Vector3& origin);
             void DrawVoxelGridDepthOnlyOrtho(DepthBuffer& depthbuffer, const VoxelGrid& voxel_grid);
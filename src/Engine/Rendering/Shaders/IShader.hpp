@@ -88,6 +88,17 @@ namespace Engine
                     return interpolated;
                 }
 
+                // how much an interpolated value changes for one pixel to the right and one pixel down, i.e the texture coordinates derivatives for mipmapping
+                template<typename T>
+                inline void PerspectiveCorrectDerivatives(const T& value0, const T& value1, const T& value2, const Triangle& triangle, float barcoord0, float barcoord1, float barcoord2, const T& interpolated, T& out_dx, T& out_dy) const
+                {
+                    float barcoord2_dx = -(triangle.barcoord0_dx + triangle.barcoord1_dx);
+                    float barcoord2_dy = -(triangle.barcoord0_dy + triangle.barcoord1_dy);
+
+                    out_dx = PerspectiveCorrectInterpolate<T>(value0, value1, value2, triangle, barcoord0 + triangle.barcoord0_dx, barcoord1 + triangle.barcoord1_dx, barcoord2 + barcoord2_dx) - interpolated;
+                    out_dy = PerspectiveCorrectInterpolate<T>(value0, value1, value2, triangle, barcoord0 + triangle.barcoord0_dy, barcoord1 + triangle.barcoord1_dy, barcoord2 + barcoord2_dy) - interpolated;
+                }
+
             public:
                 virtual bool VertexShader(Vertex& v0, Vertex& v1, Vertex& v2, const MVPTransform& mvp_mats)                                  = 0;
                 virtual RGBColor FragmentShader(RGBColor color, const Triangle& triangle, float barcoord0, float barcoord1, float barcoord2) = 0;
@@ -28,7 +28,23 @@ namespace Engine
             {
                 Vector2 frag_texture_coord = PerspectiveCorrectInterpolate<Vector2>(vert_v0_texture_coord, vert_v1_texture_coord, vert_v2_texture_coord, triangle, barcoord0, barcoord1, barcoord2);
 
-                RGBColor final_color = texture->GetColorFromTextureCoords(frag_texture_coord.x, frag_texture_coord.y);
+                RGBColor final_color;
+
+                if (texture->HasMipmaps())
+                {
+                    Vector2 frag_texture_coord_dx;
+                    Vector2 frag_texture_coord_dy;
+
+                    PerspectiveCorrectDerivatives<Vector2>(
+                        vert_v0_texture_coord, vert_v1_texture_coord, vert_v2_texture_coord, triangle, barcoord0, barcoord1, barcoord2, frag_texture_coord, frag_texture_coord_dx, frag_texture_coord_dy);
+
+                    final_color = texture->GetColorFromTextureCoords(frag_texture_coord, frag_texture_coord_dx, frag_texture_coord_dy);
+                }
+                else
+                {
+                    final_color = texture->GetColorFromTextureCoords(frag_texture_coord.x, frag_texture_coord.y);
+                }
+
                 final_color.BlendMultiply(color);
 
                 return final_color;
@@ -1,5 +1,6 @@
 #include "ShadedShader.hpp"
 
+#include "Math/Util/FastMath.hpp"
 #include "Math/Util/MathUtil.hpp"
 
 #include <algorithm>
@@ -34,6 +35,21 @@ namespace Engine
                 has_normal_map = false;
             }
 
+            void ShadedShader::SetTangentSpaceLighting(bool tangent_space_lighting)
+            {
+                this->tangent_space_lighting = tangent_space_lighting;
+            }
+
+            void ShadedShader::SetShadingOptions(ShadingOptions shading_options)
+            {
+                this->shading_options = shading_options;
+            }
+
+            void ShadedShader::SetPerPixelShadows(bool per_pixel_shadows)
+            {
+                this->per_pixel_shadows = per_pixel_shadows;
+            }
+
             void ShadedShader::SetCameraPosition(const Vector3& cam_pos)
             {
                 camera_position = cam_pos;
@@ -44,6 +60,37 @@ namespace Engine
                 this->material_properties = material_properties;
             }
 
+            Vector3 ShadedShader::ToTangentSpace(const Vector3& vector, const Vertex& vertex) const
+            {
+                return vertex.GetTangent() * vector.x + vertex.GetBitangent() * vector.y + vertex.GetNormal() * vector.z;
+            }
+
+            void ShadedShader::GetVertexLitColors(const Vertex& vertex, const Vertex vertex_lights[], Vector3& out_lit_color, Vector3 out_shadowed_colors[]) const
+            {
+                RGBColor lit_color;
+
+                if (per_pixel_shadows)
+                {
+                    RGBColor shadowed_colors[LightTable::max_shadow_maps];
+
+                    lit_color = lighting_system->GetUnshadowedLitColorAt(vertex.GetPosition(), vertex.GetNormal(), camera_position, material_properties, shadowed_colors);
+
+                    for (int i = 0; i < vert_lights_count; i++)
+                        out_shadowed_colors[i] = Vector3(shadowed_colors[i].r, shadowed_colors[i].g, shadowed_colors[i].b);
+                }
+                else
+                {
+                    Vector3 vertex_position_lights[LightTable::max_shadow_maps];
+
+                    for (int i = 0; i < vert_lights_count; i++)
+                        vertex_position_lights[i] = vertex_lights[i].GetPosition();
+
+                    lit_color = lighting_system->GetLitColorAt(vertex.GetPosition(), vertex.GetNormal(), camera_position, vertex_position_lights, material_properties);
+                }
+
+                out_lit_color = Vector3(lit_color.r, lit_color.g, lit_color.b);
+            }
+
             bool ShadedShader::VertexShader(Vertex& v0, Vertex& v1, Vertex& v2, const MVPTransform& mvp_mats)
             {
                 TransformVertexModel(v0, mvp_mats);
@@ -54,18 +101,41 @@ namespace Engine
                 vert_v1_model = v1;
                 vert_v2_model = v2;
 
-                vert_lights_count = 0;
+                bool is_per_vertex = shading_options == ShadingOptions::PER_VERTEX;
 
-                for (std::shared_ptr<ILight> light : lighting_system->GetLights())
+                if (has_normal_map && tangent_space_lighting && !is_per_vertex)
                 {
-                    if (!light->IsShadowCaster())
-                        continue;
+                    size_t light_count = lighting_system->GetLightTable().GetLightCount();
+
+                    vert_v0_light_vectors.resize(light_count);
+                    vert_v1_light_vectors.resize(light_count);
+                    vert_v2_light_vectors.resize(light_count);
+                    frag_light_vectors.resize(light_count);
+
+                    lighting_system->GetLightVectorsAt(v0.GetPosition(), vert_v0_light_vectors.data());
+                    lighting_system->GetLightVectorsAt(v1.GetPosition(), vert_v1_light_vectors.data());
+                    lighting_system->GetLightVectorsAt(v2.GetPosition(), vert_v2_light_vectors.data());
+
+                    // the vectors are not normalized so they interpolate linearly across the triangle, the attenuation is left for the fragments
+                    for (size_t i = 0; i < light_count; i++)
+                    {
+                        vert_v0_light_vectors[i] = ToTangentSpace(vert_v0_light_vectors[i], v0);
+                        vert_v1_light_vectors[i] = ToTangentSpace(vert_v1_light_vectors[i], v1);
+                        vert_v2_light_vectors[i] = ToTangentSpace(vert_v2_light_vectors[i], v2);
+                    }
+
+                    vert_v0_view_vector = ToTangentSpace(camera_position - v0.GetPosition(), v0);
+                    vert_v1_view_vector = ToTangentSpace(camera_position - v1.GetPosition(), v1);
+                    vert_v2_view_vector = ToTangentSpace(camera_position - v2.GetPosition(), v2);
+                }
+
+                vert_lights_count = 0;
 
-                    const Matrix4& light_unused_mat     = Matrix4().SetIdentity();
-                    const Matrix4& light_view_mat       = light->GetViewMatrix().value().get();
-                    const Matrix4& light_projection_mat = light->GetProjectionMatrix().value().get();
+                for (const LightShadowMap& shadow_map : lighting_system->GetLightTable().shadow_maps)
+                {
+                    const Matrix4& light_unused_mat = Matrix4().SetIdentity();
 
-                    MVPTransform light_mvp_mats = { light_unused_mat, light_unused_mat, light_view_mat, light_projection_mat };
+                    MVPTransform light_mvp_mats = { light_unused_mat, light_unused_mat, *shadow_map.view_mat, *shadow_map.projection_mat };
 
                     vert_v0_light[vert_lights_count] = v0;
                     vert_v1_light[vert_lights_count] = v1;
@@ -79,8 +149,8 @@ namespace Engine
                     vert_v1_light[vert_lights_count].PerspectiveDivide();
                     vert_v2_light[vert_lights_count].PerspectiveDivide();
 
-                    vert_light_depthbuffer[vert_lights_count]        = &(light->GetLightDepthBuffer().value().get());
-                    vert_light_islinearprojection[vert_lights_count] = light->IsLinearProjection().value();
+                    vert_light_depthbuffer[vert_lights_count]        = shadow_map.depthbuffer;
+                    vert_light_islinearprojection[vert_lights_count] = shadow_map.is_linear_projection;
 
                     vert_lights_count++;
                 }
@@ -89,54 +159,147 @@ namespace Engine
                 TransformVertexViewProjection(v1, mvp_mats);
                 TransformVertexViewProjection(v2, mvp_mats);
 
-                return !IsBackface(v0.GetPosition(), v1.GetPosition(), v2.GetPosition());
+                if (IsBackface(v0.GetPosition(), v1.GetPosition(), v2.GetPosition()))
+                    return false;
+
+                // the vertices are lit in world space, after the backfaces are discarded
+                if (is_per_vertex)
+                {
+                    GetVertexLitColors(vert_v0_model, vert_v0_light, vert_v0_lit_color, vert_v0_shadowed_colors);
+                    GetVertexLitColors(vert_v1_model, vert_v1_light, vert_v1_lit_color, vert_v1_shadowed_colors);
+                    GetVertexLitColors(vert_v2_model, vert_v2_light, vert_v2_lit_color, vert_v2_shadowed_colors);
+                }
+
+                return true;
             }
 
-            RGBColor ShadedShader::FragmentShader(RGBColor color, const Triangle& triangle, float barcoord0, float barcoord1, float barcoord2)
+            RGBColor ShadedShader::GetPixelLitColor(const Triangle& triangle,
+                                                    float barcoord0,
+                                                    float barcoord1,
+                                                    float barcoord2,
+                                                    const Vector2& frag_texture_coord,
+                                                    const Vector2& frag_texture_coord_dx,
+                                                    const Vector2& frag_texture_coord_dy)
             {
                 Vector3 frag_position = PerspectiveCorrectInterpolate<Vector3>(vert_v0_model.GetPosition(), vert_v1_model.GetPosition(), vert_v2_model.GetPosition(), triangle, barcoord0, barcoord1, barcoord2);
 
-                Vector2 frag_texture_coord = PerspectiveCorrectInterpolate<Vector2>(vert_v0_model.GetTextureCoords(), vert_v1_model.GetTextureCoords(), vert_v2_model.GetTextureCoords(), triangle, barcoord0, barcoord1, barcoord2);
+                bool is_tangent_space = has_normal_map && tangent_space_lighting;
 
-                Vector3 frag_normal = PerspectiveCorrectInterpolate<Vector3>(vert_v0_model.GetNormal(), vert_v1_model.GetNormal(), vert_v2_model.GetNormal(), triangle, barcoord0, barcoord1, barcoord2);
+                Vector3 frag_normal;
+                Vector3 frag_view_vector;
 
-                if (has_normal_map)
+                if (is_tangent_space)
                 {
-                    Vector3 frag_tangent = PerspectiveCorrectInterpolate<Vector3>(vert_v0_model.GetTangent(), vert_v1_model.GetTangent(), vert_v2_model.GetTangent(), triangle, barcoord0, barcoord1, barcoord2);
-
-                    Vector3 frag_bitangent = PerspectiveCorrectInterpolate<Vector3>(vert_v0_model.GetBitangent(), vert_v1_model.GetBitangent(), vert_v2_model.GetBitangent(), triangle, barcoord0, barcoord1, barcoord2);
-
-                    RGBColor frag_normal_color = normal_map->GetColorFromTextureCoords(frag_texture_coord.x, frag_texture_coord.y);
-
-                    // tangent bitangent normal matrix to translate normal to world space
-                    Matrix4 tbn_mat = Matrix4().SetTBNMatrix(frag_tangent, frag_bitangent, frag_normal);
+                    RGBColor frag_normal_color = normal_map->GetColorFromTextureCoords(frag_texture_coord, frag_texture_coord_dx, frag_texture_coord_dy);
 
                     frag_normal = Vector3(Util::Lerp((float)frag_normal_color.r, 0.0f, 255.0f, -1.0f, 1.0f),
                                           Util::Lerp((float)frag_normal_color.g, 0.0f, 255.0f, -1.0f, 1.0f),
                                           Util::Lerp((float)frag_normal_color.b, 0.0f, 255.0f, -1.0f, 1.0f));
 
-                    frag_normal *= tbn_mat;
+                    frag_normal.FastNormalize();
+
+                    for (size_t i = 0; i < frag_light_vectors.size(); i++)
+                        frag_light_vectors[i] = PerspectiveCorrectInterpolate<Vector3>(vert_v0_light_vectors[i], vert_v1_light_vectors[i], vert_v2_light_vectors[i], triangle, barcoord0, barcoord1, barcoord2);
+
+                    frag_view_vector = PerspectiveCorrectInterpolate<Vector3>(vert_v0_view_vector, vert_v1_view_vector, vert_v2_view_vector, triangle, barcoord0, barcoord1, barcoord2);
+                }
+                else
+                {
+                    frag_normal = PerspectiveCorrectInterpolate<Vector3>(vert_v0_model.GetNormal(), vert_v1_model.GetNormal(), vert_v2_model.GetNormal(), triangle, barcoord0, barcoord1, barcoord2);
+
+                    if (has_normal_map)
+                    {
+                        Vector3 frag_tangent = PerspectiveCorrectInterpolate<Vector3>(vert_v0_model.GetTangent(), vert_v1_model.GetTangent(), vert_v2_model.GetTangent(), triangle, barcoord0, barcoord1, barcoord2);
+
+                        Vector3 frag_bitangent = PerspectiveCorrectInterpolate<Vector3>(vert_v0_model.GetBitangent(), vert_v1_model.GetBitangent(), vert_v2_model.GetBitangent(), triangle, barcoord0, barcoord1, barcoord2);
+
+                        RGBColor frag_normal_color = normal_map->GetColorFromTextureCoords(frag_texture_coord, frag_texture_coord_dx, frag_texture_coord_dy);
+
+                        // tangent bitangent normal matrix to translate normal to world space
+                        Matrix4 tbn_mat = Matrix4().SetTBNMatrix(frag_tangent, frag_bitangent, frag_normal);
+
+                        frag_normal = Vector3(Util::Lerp((float)frag_normal_color.r, 0.0f, 255.0f, -1.0f, 1.0f),
+                                              Util::Lerp((float)frag_normal_color.g, 0.0f, 255.0f, -1.0f, 1.0f),
+                                              Util::Lerp((float)frag_normal_color.b, 0.0f, 255.0f, -1.0f, 1.0f));
+
+                        frag_normal *= tbn_mat;
+
+                        frag_normal.FastNormalize();
+                    }
+                }
+
+                if (is_tangent_space)
+                    return lighting_system->GetLitColorAt(frag_position, frag_normal, frag_light_vectors.data(), frag_view_vector, frag_position_lights, material_properties);
+                else
+                    return lighting_system->GetLitColorAt(frag_position, frag_normal, camera_position, frag_position_lights, material_properties);
+            }
 
-                    frag_normal.Normalize();
+            RGBColor ShadedShader::GetVertexLitColor(const Triangle& triangle, float barcoord0, float barcoord1, float barcoord2) const
+            {
+                Vector3 frag_lit_color = PerspectiveCorrectInterpolate<Vector3>(vert_v0_lit_color, vert_v1_lit_color, vert_v2_lit_color, triangle, barcoord0, barcoord1, barcoord2);
+
+                if (per_pixel_shadows)
+                {
+                    for (int i = 0; i < vert_lights_count; i++)
+                    {
+                        if (!lighting_system->IsInShadow(i, frag_position_lights))
+                            frag_lit_color += PerspectiveCorrectInterpolate<Vector3>(vert_v0_shadowed_colors[i], vert_v1_shadowed_colors[i], vert_v2_shadowed_colors[i], triangle, barcoord0, barcoord1, barcoord2);
+                    }
                 }
 
-                for (int i = 0; i < vert_lights_count; i++)
+                return RGBColor(Util::ClampToByte(frag_lit_color.x), Util::ClampToByte(frag_lit_color.y), Util::ClampToByte(frag_lit_color.z));
+            }
+
+            RGBColor ShadedShader::FragmentShader(RGBColor color, const Triangle& triangle, float barcoord0, float barcoord1, float barcoord2)
+            {
+                bool is_per_vertex = shading_options == ShadingOptions::PER_VERTEX;
+
+                Vector2 frag_texture_coord = PerspectiveCorrectInterpolate<Vector2>(vert_v0_model.GetTextureCoords(), vert_v1_model.GetTextureCoords(), vert_v2_model.GetTextureCoords(), triangle, barcoord0, barcoord1, barcoord2);
+
+                // only needed for mipmapped textures
+                Vector2 frag_texture_coord_dx;
+                Vector2 frag_texture_coord_dy;
+
+                if (texture->HasMipmaps() || (has_normal_map && !is_per_vertex && normal_map->HasMipmaps()))
                 {
-                    const Vector3& v0_position_light = vert_v0_light[i].GetPosition();
-                    const Vector3& v1_position_light = vert_v1_light[i].GetPosition();
-                    const Vector3& v2_position_light = vert_v2_light[i].GetPosition();
-
-                    if (vert_light_islinearprojection[i])
-                        frag_position_lights[i] = (v0_position_light * barcoord0) + (v1_position_light * barcoord1) + (v2_position_light * barcoord2);
-                    else
-                        frag_position_lights[i] = PerspectiveCorrectInterpolate<Vector3>(v0_position_light, v1_position_light, v2_position_light, triangle, barcoord0, barcoord1, barcoord2);
+                    PerspectiveCorrectDerivatives<Vector2>(vert_v0_model.GetTextureCoords(),
+                                                           vert_v1_model.GetTextureCoords(),
+                                                           vert_v2_model.GetTextureCoords(),
+                                                           triangle,
+                                                           barcoord0,
+                                                           barcoord1,
+                                                           barcoord2,
+                                                           frag_texture_coord,
+                                                           frag_texture_coord_dx,
+                                                           frag_texture_coord_dy);
                 }
 
-                RGBColor lit_color = lighting_system->GetLitColorAt(frag_position, frag_normal, camera_position, frag_position_lights, material_properties);
+                // the positions in the lights are only needed for the shadows tested per pixel
+                if (!is_per_vertex || per_pixel_shadows)
+                {
+                    for (int i = 0; i < vert_lights_count; i++)
+                    {
+                        const Vector3& v0_position_light = vert_v0_light[i].GetPosition();
+                        const Vector3& v1_position_light = vert_v1_light[i].GetPosition();
+                        const Vector3& v2_position_light = vert_v2_light[i].GetPosition();
+
+                        if (vert_light_islinearprojection[i])
+                            frag_position_lights[i] = (v0_position_light * barcoord0) + (v1_position_light * barcoord1) + (v2_position_light * barcoord2);
+                        else
+                            frag_position_lights[i] = PerspectiveCorrectInterpolate<Vector3>(v0_position_light, v1_position_light, v2_position_light, triangle, barcoord0, barcoord1, barcoord2);
+                    }
+                }
+
+                RGBColor lit_color;
+
+                if (is_per_vertex)
+                    lit_color = GetVertexLitColor(triangle, barcoord0, barcoord1, barcoord2);
+                else
+                    lit_color = GetPixelLitColor(triangle, barcoord0, barcoord1, barcoord2, frag_texture_coord, frag_texture_coord_dx, frag_texture_coord_dy);
 
                 lit_color += lighting_system->GetAmbientLightColor();
 
-                RGBColor final_color = texture->GetColorFromTextureCoords(frag_texture_coord.x, frag_texture_coord.y);
+                RGBColor final_color = texture->GetColorFromTextureCoords(frag_texture_coord, frag_texture_coord_dx, frag_texture_coord_dy);
 
                 final_color.BlendMultiply(color);
                 final_color.BlendMultiply(lit_color);
@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace Engine
 {
@@ -24,6 +25,14 @@ namespace Engine
             using namespace Display;
             using namespace Lighting;
 
+            enum class ShadingOptions
+            {
+                // the lighting is calculated for every pixel
+                PER_PIXEL,
+                // the lighting is calculated for the vertices and interpolated across the triangles (gouraud shading), normal maps are not used
+                PER_VERTEX
+            };
+
             class ShadedShader : public IShader
             {
             private:
@@ -40,21 +49,61 @@ namespace Engine
 
                 int vert_lights_count = 0;
                 // the same vertices but in light space, in multiple lights
-                Vertex vert_v0_light[10];
-                Vertex vert_v1_light[10];
-                Vertex vert_v2_light[10];
+                Vertex vert_v0_light[LightTable::max_shadow_maps];
+                Vertex vert_v1_light[LightTable::max_shadow_maps];
+                Vertex vert_v2_light[LightTable::max_shadow_maps];
 
                 // a pointer here is prefered to avoid calling make_shared on every triangle
-                DepthBuffer* vert_light_depthbuffer[10];
+                DepthBuffer* vert_light_depthbuffer[LightTable::max_shadow_maps];
 
                 // non linear projections need to account for perspective
-                bool vert_light_islinearprojection[10];
-
-                Vector3 frag_position_lights[10];
+                bool vert_light_islinearprojection[LightTable::max_shadow_maps];
+
+                Vector3 frag_position_lights[LightTable::max_shadow_maps];
+
+                // with a normal map the light and view vectors are moved to tangent space per vertex, so the fragments use the sampled normal as is
+                // instead of transforming it to world space
+                bool tangent_space_lighting = true;
+                // one per light, in tangent space
+                std::vector<Vector3> vert_v0_light_vectors;
+                std::vector<Vector3> vert_v1_light_vectors;
+                std::vector<Vector3> vert_v2_light_vectors;
+                std::vector<Vector3> frag_light_vectors;
+
+                Vector3 vert_v0_view_vector;
+                Vector3 vert_v1_view_vector;
+                Vector3 vert_v2_view_vector;
+
+                ShadingOptions shading_options = ShadingOptions::PER_PIXEL;
+                // with per vertex shading the lights with a shadow map are interpolated separately, so the shadows can still be tested for every pixel
+                bool per_pixel_shadows = true;
+                // the colors are kept as vectors to be interpolated, the shadowed colors are the light of each shadow map
+                Vector3 vert_v0_lit_color;
+                Vector3 vert_v1_lit_color;
+                Vector3 vert_v2_lit_color;
+                Vector3 vert_v0_shadowed_colors[LightTable::max_shadow_maps];
+                Vector3 vert_v1_shadowed_colors[LightTable::max_shadow_maps];
+                Vector3 vert_v2_shadowed_colors[LightTable::max_shadow_maps];
 
                 bool has_normal_map;
                 MaterialProperties material_properties;
 
+                // the inverse of the tbn matrix the normal map is transformed with in world space lighting, which is it's transpose
+                [[nodiscard]] Vector3 ToTangentSpace(const Vector3& vector, const Vertex& vertex) const;
+
+                // the vertex is in world space and the same vertex in each light's NDC space for the shadows, which are only used when they're not per pixel
+                void GetVertexLitColors(const Vertex& vertex, const Vertex vertex_lights[], Vector3& out_lit_color, Vector3 out_shadowed_colors[]) const;
+
+                [[nodiscard]] RGBColor GetPixelLitColor(const Triangle& triangle,
+                                                        float barcoord0,
+                                                        float barcoord1,
+                                                        float barcoord2,
+                                                        const Vector2& frag_texture_coord,
+                                                        const Vector2& frag_texture_coord_dx,
+                                                        const Vector2& frag_texture_coord_dy);
+                // the interpolated vertex colors, with the shadowed colors added where the pixel is not in their shadow
+                [[nodiscard]] RGBColor GetVertexLitColor(const Triangle& triangle, float barcoord0, float barcoord1, float barcoord2) const;
+
             public:
                 virtual bool VertexShader(Vertex& v0, Vertex& v1, Vertex& v2, const MVPTransform& mvp_mats) override;
                 virtual RGBColor FragmentShader(RGBColor color, const Triangle& triangle, float barcoord0, float barcoord1, float barcoord2) override;
@@ -64,6 +113,9 @@ namespace Engine
                 void SetTexture(std::shared_ptr<Texture> texture);
                 void SetNormalMap(std::shared_ptr<Texture> normal_map);
                 void DisableNormalMap();
+                void SetTangentSpaceLighting(bool tangent_space_lighting);
+                void SetShadingOptions(ShadingOptions shading_options);
+                void SetPerPixelShadows(bool per_pixel_shadows);
                 void SetCameraPosition(const Vector3& cam_pos);
                 void SetMaterialProperties(const MaterialProperties& material_properties);
             };
@@ -6,22 +6,47 @@ namespace Engine
 {
     namespace Rendering
     {
-        StaticModel::StaticModel()
+        StaticModel::StaticModel() : StaticModel(std::vector<Vertex>(), std::vector<uint32_t>())
         {
         }
 
-        StaticModel::StaticModel(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) :
-            vertices(std::make_shared<std::vector<Vertex>>()),
-            indices(std::make_shared<std::vector<uint32_t>>()),
-            vertex_buffer(this->vertices, this->indices)
+        StaticModel::StaticModel(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) : bounding_radius(0)
         {
-            *this->vertices.get() = vertices;
-            *this->indices.get()  = indices;
+            lods.emplace_back(std::make_shared<std::vector<Vertex>>(vertices), std::make_shared<std::vector<uint32_t>>(indices));
+
+            for (const Vertex& vertex : vertices)
+                bounding_radius = std::max(bounding_radius, vertex.GetPosition().GetLength());
+        }
+
+        void StaticModel::AddLod(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+        {
+            lods.emplace_back(std::make_shared<std::vector<Vertex>>(vertices), std::make_shared<std::vector<uint32_t>>(indices));
+        }
+
+        const VertexBuffer& StaticModel::GetVertexBuffer(uint32_t lod) const
+        {
+            return lods[std::min(lod, (uint32_t)lods.size() - 1)];
+        }
+
+        uint32_t StaticModel::GetLodCount() const
+        {
+            return (uint32_t)lods.size();
+        }
+
+        uint32_t StaticModel::GetLodForTriangleBudget(uint32_t max_triangles) const
+        {
+            for (uint32_t lod = 0; lod < lods.size(); lod++)
+            {
+                if (lods[lod].GetIndices().size() / 3 <= max_triangles)
+                    return lod;
+            }
+
+            return (uint32_t)lods.size() - 1;
         }
 
-        const VertexBuffer& StaticModel::GetVertexBuffer() const
+        float StaticModel::GetBoundingRadius() const
         {
-            return vertex_buffer;
+            return bounding_radius;
         }
     }
 }
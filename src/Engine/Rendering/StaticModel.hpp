@@ -14,16 +14,24 @@ namespace Engine
         class StaticModel
         {
         private:
-            std::shared_ptr<std::vector<Vertex>> vertices;
-            std::shared_ptr<std::vector<uint32_t>> indices;
+            // the full model is the first level, every next level is simpler
+            std::vector<VertexBuffer> lods;
 
-            VertexBuffer vertex_buffer;
+            // from the model origin, enough to estimate how big the model is on screen
+            float bounding_radius;
 
         public:
             StaticModel();
             StaticModel(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
 
-            const VertexBuffer& GetVertexBuffer() const;
+            void AddLod(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+
+            [[nodiscard]] const VertexBuffer& GetVertexBuffer(uint32_t lod = 0) const;
+
+            [[nodiscard]] uint32_t GetLodCount() const;
+            // the most detailed level that has at most max_triangles triangles, or the simplest one if none does
+            [[nodiscard]] uint32_t GetLodForTriangleBudget(uint32_t max_triangles) const;
+            [[nodiscard]] float GetBoundingRadius() const;
         };
     }
 }
@@ -1,24 +1,321 @@
 #include "Texture.hpp"
 
 #include <algorithm>
+#include <bit>
+#include <cmath>
+#include <unordered_map>
 
 namespace Engine
 {
     namespace Rendering
     {
-        Texture::Texture() : imagebuffer(FrameBuffer<RGBColor>(0, 0))
+        // a single black texel, what sampling an empty texture used to return
+        Texture::Texture() : Texture(FrameBuffer<RGBColor>(1, 1), TextureWrapOptions::REPEAT)
         {
         }
 
-        Texture::Texture(const FrameBuffer<RGBColor>& imagebuffer, TextureWrapOptions wrap_options) : imagebuffer(imagebuffer), wrap_options(wrap_options)
+        Texture::Texture(const FrameBuffer<RGBColor>& imagebuffer, TextureWrapOptions wrap_options, TextureFilterOptions filter_options, TextureCompressionOptions compression_options) :
+            wrap_options(wrap_options),
+            filter_options(filter_options),
+            compression_options(compression_options)
         {
+            levels.push_back(GetTextureLevel(imagebuffer));
+
+            if (filter_options != TextureFilterOptions::NEAREST)
+                GenerateMipmaps(imagebuffer);
+
+            // the mipmaps are generated from the exact colors, and each gets it's own palette since averaging adds colors
+            if (compression_options == TextureCompressionOptions::PALETTE)
+            {
+                for (TextureLevel& level : levels)
+                    PalettizeLevel(level);
+            }
+
+            SetSamplers();
+        }
+
+        void Texture::GenerateMipmaps(const FrameBuffer<RGBColor>& imagebuffer)
+        {
+            FrameBuffer<RGBColor> previous = imagebuffer;
+
+            while (previous.GetWidth() > 1 || previous.GetHeight() > 1)
+            {
+                uint16_t width  = std::max(1, previous.GetWidth() / 2);
+                uint16_t height = std::max(1, previous.GetHeight() / 2);
+
+                FrameBuffer<RGBColor> mipmap = FrameBuffer<RGBColor>(width, height);
+
+                // each texel is the average of the 2x2 texels it covers in the previous level, or less on a side that was 1 texel already
+                for (uint16_t y = 0; y < height; y++)
+                {
+                    for (uint16_t x = 0; x < width; x++)
+                    {
+                        uint16_t x0 = std::min<uint16_t>(x * 2, previous.GetWidth() - 1);
+                        uint16_t y0 = std::min<uint16_t>(y * 2, previous.GetHeight() - 1);
+                        uint16_t x1 = std::min<uint16_t>(x * 2 + 1, previous.GetWidth() - 1);
+                        uint16_t y1 = std::min<uint16_t>(y * 2 + 1, previous.GetHeight() - 1);
+
+                        RGBColor c00 = previous.GetValue(x0, y0);
+                        RGBColor c10 = previous.GetValue(x1, y0);
+                        RGBColor c01 = previous.GetValue(x0, y1);
+                        RGBColor c11 = previous.GetValue(x1, y1);
+
+                        mipmap.SetValue(x,
+                                        y,
+                                        RGBColor((uint8_t)((c00.r + c10.r + c01.r + c11.r + 2) / 4),
+                                                 (uint8_t)((c00.g + c10.g + c01.g + c11.g + 2) / 4),
+                                                 (uint8_t)((c00.b + c10.b + c01.b + c11.b + 2) / 4)));
+                    }
+                }
+
+                levels.push_back(GetTextureLevel(mipmap));
+                previous = mipmap;
+            }
+        }
+
+        void Texture::SetSamplers()
+        {
+            const TextureLevel& level = levels.front();
+
+            bool is_power_of_two = std::has_single_bit(level.width) && std::has_single_bit(level.height);
+            bool is_palettized   = compression_options == TextureCompressionOptions::PALETTE;
+
+            switch (wrap_options)
+            {
+            case TextureWrapOptions::REPEAT:
+                if (is_power_of_two)
+                    SetSamplers<TextureWrapOptions::REPEAT, true>(is_palettized);
+                else
+                    SetSamplers<TextureWrapOptions::REPEAT, false>(is_palettized);
+                break;
+            case TextureWrapOptions::CLAMP:
+                if (is_power_of_two)
+                    SetSamplers<TextureWrapOptions::CLAMP, true>(is_palettized);
+                else
+                    SetSamplers<TextureWrapOptions::CLAMP, false>(is_palettized);
+                break;
+            case TextureWrapOptions::BORDER:
+                if (is_power_of_two)
+                    SetSamplers<TextureWrapOptions::BORDER, true>(is_palettized);
+                else
+                    SetSamplers<TextureWrapOptions::BORDER, false>(is_palettized);
+                break;
+            }
+        }
+
+        template<TextureWrapOptions wrap, bool is_power_of_two>
+        void Texture::SetSamplers(bool is_palettized)
+        {
+            if (is_palettized)
+            {
+                sample_nearest  = &TextureSampler<wrap, is_power_of_two, true>::SampleNearest;
+                sample_bilinear = &TextureSampler<wrap, is_power_of_two, true>::SampleBilinear;
+            }
+            else
+            {
+                sample_nearest  = &TextureSampler<wrap, is_power_of_two, false>::SampleNearest;
+                sample_bilinear = &TextureSampler<wrap, is_power_of_two, false>::SampleBilinear;
+            }
+        }
+
+        TextureLevel Texture::GetTextureLevel(const FrameBuffer<RGBColor>& imagebuffer)
+        {
+            TextureLevel level;
+
+            level.width  = imagebuffer.GetWidth();
+            level.height = imagebuffer.GetHeight();
+
+            // the mipmaps of a power of two texture are power of two too, so the whole chain is morton ordered or none of it is
+            if (std::has_single_bit(level.width) && std::has_single_bit(level.height))
+            {
+                uint32_t interleaved_bits = std::min(std::countr_zero(level.width), std::countr_zero(level.height));
+
+                level.x_offsets = GetMortonOffsets(level.width, 0, interleaved_bits);
+                level.y_offsets = GetMortonOffsets(level.height, 1, interleaved_bits);
+            }
+            else
+            {
+                level.x_offsets.resize(level.width);
+                level.y_offsets.resize(level.height);
+
+                for (uint32_t x = 0; x < level.width; x++)
+                    level.x_offsets[x] = x;
+
+                for (uint32_t y = 0; y < level.height; y++)
+                    level.y_offsets[y] = y * level.width;
+            }
+
+            level.texels.resize(level.width * level.height);
+
+            for (uint16_t y = 0; y < level.height; y++)
+            {
+                for (uint16_t x = 0; x < level.width; x++)
+                    level.texels[level.x_offsets[x] + level.y_offsets[y]] = imagebuffer.GetValue(x, y).GetHexValues();
+            }
+
+            return level;
+        }
+
+        std::vector<uint32_t> Texture::GetMortonOffsets(uint16_t size, uint32_t shift, uint32_t interleaved_bits)
+        {
+            std::vector<uint32_t> offsets(size, 0);
+
+            // the low bits of both coordinates are interleaved, the bits the longer side has left over go on top of them
+            for (uint32_t coord = 0; coord < size; coord++)
+            {
+                for (uint32_t bit = 0; (1u << bit) < size; bit++)
+                {
+                    if ((coord & (1u << bit)) == 0)
+                        continue;
+
+                    if (bit < interleaved_bits)
+                        offsets[coord] |= 1u << (bit * 2 + shift);
+                    else
+                        offsets[coord] |= 1u << (bit + interleaved_bits);
+                }
+            }
+
+            return offsets;
+        }
+
+        void Texture::PalettizeLevel(TextureLevel& level)
+        {
+            // every distinct color and how many texels use it
+            std::unordered_map<uint32_t, uint32_t> histogram;
+
+            for (uint32_t texel : level.texels)
+                histogram[texel]++;
+
+            std::vector<std::pair<uint32_t, uint32_t>> colors(histogram.begin(), histogram.end());
+
+            // ranges of colors, split in half at the texel count median of their widest channel until there are enough of them,
+            // textures with few colors end up with one color per box and are stored exactly
+            std::vector<std::pair<size_t, size_t>> boxes = {{0, colors.size()}};
+
+            while (boxes.size() < palette_size)
+            {
+                int64_t best_box     = -1;
+                uint32_t best_shift  = 0;
+                uint64_t best_weight = 0;
+
+                for (size_t i = 0; i < boxes.size(); i++)
+                {
+                    if (boxes[i].second - boxes[i].first < 2)
+                        continue;
+
+                    uint32_t texel_count = 0;
+                    uint32_t min[3]      = {255, 255, 255};
+                    uint32_t max[3]      = {0, 0, 0};
+
+                    for (size_t c = boxes[i].first; c < boxes[i].second; c++)
+                    {
+                        texel_count += colors[c].second;
+
+                        for (uint32_t channel = 0; channel < 3; channel++)
+                        {
+                            uint32_t value = (colors[c].first >> (channel * 8)) & 0xFF;
+
+                            min[channel] = std::min(min[channel], value);
+                            max[channel] = std::max(max[channel], value);
+                        }
+                    }
+
+                    // the boxes that cover many texels over a wide range of colors lose the most detail
+                    for (uint32_t channel = 0; channel < 3; channel++)
+                    {
+                        uint64_t weight = (uint64_t)(max[channel] - min[channel]) * texel_count;
+
+                        if (weight > best_weight)
+                        {
+                            best_box    = i;
+                            best_shift  = channel * 8;
+                            best_weight = weight;
+                        }
+                    }
+                }
+
+                if (best_box < 0)
+                    break;
+
+                auto [first, last] = boxes[best_box];
+
+                std::sort(colors.begin() + first,
+                          colors.begin() + last,
+                          [best_shift](const auto& a, const auto& b) { return ((a.first >> best_shift) & 0xFF) < ((b.first >> best_shift) & 0xFF); });
+
+                uint64_t half_count = 0;
+
+                for (size_t c = first; c < last; c++)
+                    half_count += colors[c].second;
+
+                half_count /= 2;
+
+                // both halves keep at least one color
+                size_t split = first + 1;
+
+                for (uint64_t count = colors[first].second; split < last - 1 && count < half_count; split++)
+                    count += colors[split].second;
+
+                boxes[best_box] = {first, split};
+                boxes.push_back({split, last});
+            }
+
+            std::unordered_map<uint32_t, uint8_t> color_indices;
+
+            level.palette.clear();
+
+            // each box becomes the texel count weighted average of it's colors
+            for (const auto& [first, last] : boxes)
+            {
+                uint64_t sums[3]   = {0, 0, 0};
+                uint64_t box_count = 0;
+
+                for (size_t c = first; c < last; c++)
+                {
+                    for (uint32_t channel = 0; channel < 3; channel++)
+                        sums[channel] += (uint64_t)((colors[c].first >> (channel * 8)) & 0xFF) * colors[c].second;
+
+                    box_count += colors[c].second;
+                    color_indices[colors[c].first] = (uint8_t)level.palette.size();
+                }
+
+                uint32_t color = 0;
+
+                for (uint32_t channel = 0; channel < 3; channel++)
+                    color |= (uint32_t)((sums[channel] + box_count / 2) / box_count) << (channel * 8);
+
+                level.palette.push_back(color);
+            }
+
+            level.palette_indices.resize(level.texels.size());
+
+            for (size_t i = 0; i < level.texels.size(); i++)
+                level.palette_indices[i] = color_indices[level.texels[i]];
+
+            level.texels.clear();
+            level.texels.shrink_to_fit();
         }
 
         FrameBuffer<RGBColor> Texture::GetBuffer() const
         {
+            const TextureLevel& level = levels.front();
+
+            FrameBuffer<RGBColor> imagebuffer = FrameBuffer<RGBColor>(level.width, level.height);
+
+            for (uint16_t y = 0; y < level.height; y++)
+            {
+                for (uint16_t x = 0; x < level.width; x++)
+                    imagebuffer.SetValue(x, y, RGBColor(level.palette.empty() ? level.GetTexel(x, y) : level.GetPaletteTexel(x, y)));
+            }
+
             return imagebuffer;
         }
 
+        bool Texture::HasMipmaps() const
+        {
+            return levels.size() > 1;
+        }
+
         RGBColor Texture::GetColorFromTextureCoords(const Vector2& texture_coords)
         {
             return GetColorFromTextureCoords(texture_coords.x, texture_coords.y);
@@ -26,35 +323,40 @@ namespace Engine
 
         RGBColor Texture::GetColorFromTextureCoords(float x, float y)
         {
-            switch (wrap_options)
-            {
-            case TextureWrapOptions::CLAMP:
-                x = std::clamp(x, 0.0f, 1.0f);
-                y = std::clamp(y, 0.0f, 1.0f);
-                break;
-            case TextureWrapOptions::REPEAT:
-                if (x < 0)
-                    x *= -1;
-                if (y < 0)
-                    y *= -1;
+            return sample_nearest(levels.front(), x, y);
+        }
 
-                x = x - (uint32_t)x;
-                y = y - (uint32_t)y;
-                break;
-            case TextureWrapOptions::BORDER:
-                if ((x < 0.0f || x > 1.0f) || (y < 0.0f || y > 1.0f))
-                    return RGBColor(255, 1, 1);
-            }
+        RGBColor Texture::GetColorFromTextureCoords(const Vector2& texture_coords, const Vector2& texture_coords_dx, const Vector2& texture_coords_dy)
+        {
+            if (filter_options == TextureFilterOptions::NEAREST || levels.size() == 1)
+                return sample_nearest(levels.front(), texture_coords.x, texture_coords.y);
+
+            float width  = levels.front().width;
+            float height = levels.front().height;
+
+            // how many texels of the full size texture the pixel covers along it's longest side
+            float texels_dx = std::hypot(texture_coords_dx.x * width, texture_coords_dx.y * height);
+            float texels_dy = std::hypot(texture_coords_dy.x * width, texture_coords_dy.y * height);
+
+            float level = std::clamp(std::log2(std::max({texels_dx, texels_dy, 1.0f})), 0.0f, (float)(levels.size() - 1));
+
+            if (filter_options == TextureFilterOptions::BILINEAR)
+                return sample_bilinear(levels[(uint32_t)(level + 0.5f)], texture_coords.x, texture_coords.y);
+
+            uint32_t level_floor = (uint32_t)level;
+            uint32_t weight      = (uint32_t)((level - level_floor) * 256.0f);
+
+            uint32_t color0 = sample_bilinear(levels[level_floor], texture_coords.x, texture_coords.y).GetHexValues();
+
+            if (weight == 0)
+                return RGBColor(color0);
 
-            uint16_t text_x = (uint16_t)(x * imagebuffer.GetWidth());
-            uint16_t text_y = (uint16_t)(y * imagebuffer.GetHeight());
+            uint32_t color1 = sample_bilinear(levels[level_floor + 1], texture_coords.x, texture_coords.y).GetHexValues();
 
-            // TODO: remove this
-            if (text_x >= imagebuffer.GetWidth() || text_y >= imagebuffer.GetHeight())
-                return RGBColor(0, 0, 0);
+            uint32_t red_blue = ((color0 & 0xFF00FF) * (256 - weight) + (color1 & 0xFF00FF) * weight) >> 8;
+            uint32_t green    = ((color0 & 0x00FF00) * (256 - weight) + (color1 & 0x00FF00) * weight) >> 8;
 
-            //	return RGBColor(x * 255, 0, 0);
-            return imagebuffer.GetValue(text_x, text_y);
+            return RGBColor((red_blue & 0xFF00FF) | (green & 0x00FF00));
         }
     }
 }
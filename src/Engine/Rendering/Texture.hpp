@@ -4,9 +4,11 @@
 #include "Display/FrameBuffer.hpp"
 #include "Display/RGBColor.hpp"
 #include "Math/Vector2.hpp"
+#include "TextureSampler.hpp"
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace Engine
 {
@@ -15,27 +17,48 @@ namespace Engine
         using namespace Display;
         using namespace Math;
 
-        enum class TextureWrapOptions
-        {
-            REPEAT,
-            CLAMP,
-            BORDER
-        };
-
         class Texture
         {
         private:
-            FrameBuffer<RGBColor> imagebuffer;
+            static constexpr uint32_t palette_size = 256;
+
+            // the level 0 is the full size texture, each mipmap after it is half the size of the previous one, down to 1x1
+            std::vector<TextureLevel> levels;
 
             TextureWrapOptions wrap_options;
+            TextureFilterOptions filter_options;
+            TextureCompressionOptions compression_options;
+
+            // picked once for the wrapping and size of the texture, so sampling doesn't branch on them
+            RGBColor (*sample_nearest)(const TextureLevel& level, float x, float y);
+            RGBColor (*sample_bilinear)(const TextureLevel& level, float x, float y);
+
+            void GenerateMipmaps(const FrameBuffer<RGBColor>& imagebuffer);
+            void SetSamplers();
+
+            template<TextureWrapOptions wrap, bool is_power_of_two>
+            void SetSamplers(bool is_palettized);
+
+            [[nodiscard]] static TextureLevel GetTextureLevel(const FrameBuffer<RGBColor>& imagebuffer);
+            [[nodiscard]] static std::vector<uint32_t> GetMortonOffsets(uint16_t size, uint32_t shift, uint32_t interleaved_bits);
+
+            // replaces the texels with indices to a median cut palette
+            static void PalettizeLevel(TextureLevel& level);
 
         public:
             Texture();
-            Texture(const FrameBuffer<RGBColor>& imagebuffer, TextureWrapOptions wrap_options);
+            Texture(const FrameBuffer<RGBColor>& imagebuffer,
+                    TextureWrapOptions wrap_options,
+                    TextureFilterOptions filter_options           = TextureFilterOptions::NEAREST,
+                    TextureCompressionOptions compression_options = TextureCompressionOptions::NONE);
 
             [[nodiscard]] FrameBuffer<RGBColor> GetBuffer() const;
+            [[nodiscard]] bool HasMipmaps() const;
+
             [[nodiscard]] RGBColor GetColorFromTextureCoords(const Vector2& texture_coords);
             [[nodiscard]] RGBColor GetColorFromTextureCoords(float x, float y);
+            // filtered sample, the derivatives are how much the texture coordinates change for one pixel to the right and one pixel down
+            [[nodiscard]] RGBColor GetColorFromTextureCoords(const Vector2& texture_coords, const Vector2& texture_coords_dx, const Vector2& texture_coords_dy);
         };
     }
 }
@@ -0,0 +1,164 @@
+#ifndef TEXTURESAMPLER_HPP
+#define TEXTURESAMPLER_HPP
+
+#include "Display/RGBColor.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+    namespace Rendering
+    {
+        using namespace Display;
+
+        enum class TextureWrapOptions
+        {
+            REPEAT,
+            CLAMP,
+            BORDER
+        };
+
+        enum class TextureFilterOptions
+        {
+            // no mipmaps, a single texel per sample
+            NEAREST,
+            // bilinear sampling of the closest mipmap
+            BILINEAR,
+            // bilinear sampling of the two closest mipmaps, blended
+            TRILINEAR
+        };
+
+        enum class TextureCompressionOptions
+        {
+            // 4 bytes per texel
+            NONE,
+            // 1 byte per texel, indices to a palette of up to 256 colors for each mipmap, for textures that don't need every color exact
+            PALETTE
+        };
+
+        // a single mipmap of a texture, the colors are packed as 0x00RRGGBB
+        struct TextureLevel
+        {
+            uint16_t width;
+            uint16_t height;
+
+            // in morton order (the bits of x and y interleaved) for power of two sizes, so texels close on screen are close in memory,
+            // otherwise in rows, only one of texels and palette_indices is used
+            std::vector<uint32_t> texels;
+            std::vector<uint8_t> palette_indices;
+            std::vector<uint32_t> palette;
+
+            // the position of a texel is x_offsets[x] + y_offsets[y], whatever the order of the texels is
+            std::vector<uint32_t> x_offsets;
+            std::vector<uint32_t> y_offsets;
+
+            [[nodiscard]] inline uint32_t GetTexel(int32_t x, int32_t y) const
+            {
+                return texels[x_offsets[x] + y_offsets[y]];
+            }
+
+            [[nodiscard]] inline uint32_t GetPaletteTexel(int32_t x, int32_t y) const
+            {
+                return palette[palette_indices[x_offsets[x] + y_offsets[y]]];
+            }
+        };
+
+        // the texture sampling with the wrapping and storage resolved at compile time, power of two textures wrap with a mask instead of a modulo
+        template<TextureWrapOptions wrap_options, bool is_power_of_two, bool is_palettized>
+        class TextureSampler
+        {
+        private:
+            // the same color the unspecialized sampling returned outside of bordered textures
+            static constexpr uint32_t border_color = 0xFF0101;
+
+            [[nodiscard]] static inline int32_t Floor(float value)
+            {
+                int32_t truncated = (int32_t)value;
+
+                return truncated - (value < (float)truncated);
+            }
+
+            [[nodiscard]] static inline int32_t Wrap(int32_t texel, int32_t size)
+            {
+                if constexpr (wrap_options == TextureWrapOptions::REPEAT)
+                {
+                    if constexpr (is_power_of_two)
+                        return texel & (size - 1);
+
+                    texel %= size;
+
+                    return texel < 0 ? texel + size : texel;
+                }
+
+                return std::clamp(texel, 0, size - 1);
+            }
+
+            [[nodiscard]] static inline uint32_t GetTexel(const TextureLevel& level, int32_t x, int32_t y)
+            {
+                if constexpr (is_palettized)
+                    return level.GetPaletteTexel(x, y);
+                else
+                    return level.GetTexel(x, y);
+            }
+
+        public:
+            [[nodiscard]] static RGBColor SampleNearest(const TextureLevel& level, float x, float y)
+            {
+                if constexpr (wrap_options == TextureWrapOptions::BORDER)
+                {
+                    if ((x < 0.0f || x > 1.0f) || (y < 0.0f || y > 1.0f))
+                        return RGBColor(border_color);
+                }
+
+                int32_t texel_x = Wrap(Floor(x * level.width), level.width);
+                int32_t texel_y = Wrap(Floor(y * level.height), level.height);
+
+                return RGBColor(GetTexel(level, texel_x, texel_y));
+            }
+
+            [[nodiscard]] static RGBColor SampleBilinear(const TextureLevel& level, float x, float y)
+            {
+                if constexpr (wrap_options == TextureWrapOptions::BORDER)
+                {
+                    if ((x < 0.0f || x > 1.0f) || (y < 0.0f || y > 1.0f))
+                        return RGBColor(border_color);
+                }
+
+                // texel centers are at .5, the weights are in 1/16 steps so the four of them multiplied add up to exactly 256
+                float texel_x = x * level.width - 0.5f;
+                float texel_y = y * level.height - 0.5f;
+
+                int32_t texel_x0 = Floor(texel_x);
+                int32_t texel_y0 = Floor(texel_y);
+
+                uint32_t weight_x = (uint32_t)((texel_x - (float)texel_x0) * 16.0f);
+                uint32_t weight_y = (uint32_t)((texel_y - (float)texel_y0) * 16.0f);
+
+                int32_t x0 = Wrap(texel_x0, level.width);
+                int32_t y0 = Wrap(texel_y0, level.height);
+                int32_t x1 = Wrap(texel_x0 + 1, level.width);
+                int32_t y1 = Wrap(texel_y0 + 1, level.height);
+
+                uint32_t c00 = GetTexel(level, x0, y0);
+                uint32_t c10 = GetTexel(level, x1, y0);
+                uint32_t c01 = GetTexel(level, x0, y1);
+                uint32_t c11 = GetTexel(level, x1, y1);
+
+                uint32_t w00 = (16 - weight_x) * (16 - weight_y);
+                uint32_t w10 = weight_x * (16 - weight_y);
+                uint32_t w01 = (16 - weight_x) * weight_y;
+                uint32_t w11 = weight_x * weight_y;
+
+                // red and blue are blended together, they have enough space between them to not overflow into each other
+                uint32_t red_blue = ((c00 & 0xFF00FF) * w00 + (c10 & 0xFF00FF) * w10 + (c01 & 0xFF00FF) * w01 + (c11 & 0xFF00FF) * w11) >> 8;
+                uint32_t green    = ((c00 & 0x00FF00) * w00 + (c10 & 0x00FF00) * w10 + (c01 & 0x00FF00) * w01 + (c11 & 0x00FF00) * w11) >> 8;
+
+                return RGBColor((red_blue & 0xFF00FF) | (green & 0x00FF00));
+            }
+        };
+    }
+}
+
+#endif
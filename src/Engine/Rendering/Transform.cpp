@@ -2,6 +2,9 @@
 
 #include "Math/Util/MathUtil.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace Engine
 {
     namespace Rendering
@@ -34,9 +37,25 @@ namespace Engine
             return scale_mat;
         }
 
+        Vector3 Transform::GetTranslation() const
+        {
+            return Vector3(translation_mat.values[0][3], translation_mat.values[1][3], translation_mat.values[2][3]);
+        }
+
+        float Transform::GetMaxScale() const
+        {
+            return std::max({std::abs(scale_mat.values[0][0]), std::abs(scale_mat.values[1][1]), std::abs(scale_mat.values[2][2])});
+        }
+
+        uint32_t Transform::GetChangeCount() const
+        {
+            return change_count;
+        }
+
         Transform& Transform::SetTranslation(const Vector3& translation)
         {
             translation_mat = Matrix4().SetTranslation(translation);
+            change_count++;
 
             return *this;
         }
@@ -49,6 +68,7 @@ namespace Engine
         Transform& Transform::SetRotation(const Quaternion& rotation)
         {
             rotation_mat = Matrix4().SetQuaternionRotation(rotation);
+            change_count++;
 
             return *this;
         }
@@ -56,6 +76,7 @@ namespace Engine
         Transform& Transform::SetScale(const Vector3& scale)
         {
             scale_mat = Matrix4().SetScale(scale);
+            change_count++;
 
             return *this;
         }
@@ -6,6 +6,8 @@
 #include "Math/Quaternion.hpp"
 #include "Math/Vector3.hpp"
 
+#include <cstdint>
+
 namespace Engine
 {
     using namespace Math;
@@ -19,6 +21,8 @@ namespace Engine
             Matrix4 rotation_mat;
             Matrix4 scale_mat;
 
+            uint32_t change_count = 0;
+
         public:
             Transform();
 
@@ -31,6 +35,12 @@ namespace Engine
             [[nodiscard]] const Matrix4& GetTranslationMatrix() const;
             [[nodiscard]] const Matrix4& GetRotationMatrix() const;
             [[nodiscard]] const Matrix4& GetScaleMatrix() const;
+
+            [[nodiscard]] Vector3 GetTranslation() const;
+            // the biggest of the scale axes
+            [[nodiscard]] float GetMaxScale() const;
+            // goes up with every set, so a renderer can tell the transform didn't change without comparing the matrices
+            [[nodiscard]] uint32_t GetChangeCount() const;
         };
     }
 }
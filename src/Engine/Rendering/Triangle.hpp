@@ -54,6 +54,13 @@ namespace Engine
             const Vector3& v0_screen;
             const Vector3& v1_screen;
             const Vector3& v2_screen;
+
+            // how much the first two barycentric coordinates change for each pixel to the right and down (the third one is 1 minus the others),
+            // filled in by the rasterizer so the shaders can get screen space derivatives
+            float barcoord0_dx = 0;
+            float barcoord1_dx = 0;
+            float barcoord0_dy = 0;
+            float barcoord1_dy = 0;
         };
     }
 }
@@ -5,6 +5,7 @@
 #include "Math/Vector2.hpp"
 #include "Math/Vector3.hpp"
 
+#include <type_traits>
 #include <vector>
 
 namespace Engine
@@ -133,6 +134,21 @@ namespace Engine
 
             constexpr Vertex& operator*=(const Matrix4& mat) noexcept
             {
+#ifdef MATH_SSE
+                if (!std::is_constant_evaluated())
+                {
+                    alignas(16) float new_values[4];
+                    _mm_store_ps(new_values, mat.Transform(_mm_set_ps(w, position.z, position.y, position.x)));
+
+                    position.x = new_values[0];
+                    position.y = new_values[1];
+                    position.z = new_values[2];
+                    w          = new_values[3];
+
+                    return *this;
+                }
+#endif
+
                 float x_new = mat.values[0][0] * position.x + mat.values[0][1] * position.y + mat.values[0][2] * position.z + mat.values[0][3] * w;
                 float y_new = mat.values[1][0] * position.x + mat.values[1][1] * position.y + mat.values[1][2] * position.z + mat.values[1][3] * w;
                 float z_new = mat.values[2][0] * position.x + mat.values[2][1] * position.y + mat.values[2][2] * position.z + mat.values[2][3] * w;
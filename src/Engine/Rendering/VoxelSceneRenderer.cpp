@@ -28,6 +28,7 @@ namespace Engine
             shadowmap_ray_marcher.SetFrameDrawer(this->null_frame_drawer);
 
             ray_marcher.SetProjectionMatrix(this->camera->GetProjectionMatrix());
+            ray_marcher.SetMaxIterations(max_iterations);
         }
 
         void VoxelSceneRenderer::SetFrameDrawer(std::shared_ptr<IFrameDrawer> frame_drawer)
@@ -37,20 +38,23 @@ namespace Engine
             ray_marcher.SetFrameDrawer(this->frame_drawer);
         }
 
+        void VoxelSceneRenderer::SetQualityLevel(uint8_t quality_level)
+        {
+            lighting_system->SetShadowsEnabled(shadows_tier >= quality_level);
+            ray_marcher.SetMaxIterations(view_distance_tier < quality_level ? reduced_max_iterations : max_iterations);
+        }
+
         void VoxelSceneRenderer::RenderShadowMapPass()
         {
-            for (std::shared_ptr<ILight> light : lighting_system->GetLights())
+            for (const LightShadowMap& shadow_map : lighting_system->GetLightTable().shadow_maps)
             {
-                if (!light->IsShadowCaster())
-                    continue;
+                shadowmap_ray_marcher.SetProjectionMatrix(*shadow_map.projection_mat);
+                shadowmap_ray_marcher.SetViewMatrix(*shadow_map.view_mat);
 
-                shadowmap_ray_marcher.SetProjectionMatrix(light->GetProjectionMatrix().value());
-                shadowmap_ray_marcher.SetViewMatrix(light->GetViewMatrix().value());
-
-                if (light->IsLinearProjection().has_value() && light->IsLinearProjection().value())
-                    shadowmap_ray_marcher.DrawVoxelGridDepthOnlyOrtho(light->GetLightDepthBuffer().value(), *voxel_grid);
+                if (shadow_map.is_linear_projection)
+                    shadowmap_ray_marcher.DrawVoxelGridDepthOnlyOrtho(*shadow_map.depthbuffer, *voxel_grid);
                 else
-                    shadowmap_ray_marcher.DrawVoxelGridDepthOnlyPerspective(light->GetLightDepthBuffer().value(), *voxel_grid, light->GetPosition());
+                    shadowmap_ray_marcher.DrawVoxelGridDepthOnlyPerspective(*shadow_map.depthbuffer, *voxel_grid, shadow_map.position);
             }
         }
 
@@ -64,6 +68,8 @@ namespace Engine
 
         void VoxelSceneRenderer::RenderSceneShared(int64_t delta)
         {
+            lighting_system->UpdateLightTable();
+
             RenderShadowMapPass();
 
             ray_marcher.SetViewMatrix(camera->GetViewMatrix());
@@ -8,11 +8,13 @@
 #include "Display/RGBColor.hpp"
 #include "Engine/Resources/ResourceManager.hpp"
 #include "Lighting/LightingSystem.hpp"
+#include "QualityTier.hpp"
 #include "Ray.hpp"
 #include "RayMarcher.hpp"
 #include "Vector3I.hpp"
 #include "VoxelGrid.hpp"
 
+#include <array>
 #include <cstdint>
 #include <memory>
 
@@ -41,12 +43,23 @@ namespace Engine
 
             std::shared_ptr<VoxelGrid> voxel_grid;
 
+            static constexpr uint8_t shadows_tier       = 0;
+            static constexpr uint8_t view_distance_tier = 1;
+
+            // the whole grid is 100 cells across, the reduced distance still reaches the walls around the camera
+            static constexpr uint16_t max_iterations         = 1000;
+            static constexpr uint16_t reduced_max_iterations = 150;
+
             void RenderShadowMapPass();
 
         public:
+            static constexpr std::array<QualityTier, 2> quality_tiers = {{{"shadows"}, {"view distance"}}};
+
             VoxelSceneRenderer(std::shared_ptr<LightingSystem> lighting_system, std::shared_ptr<Camera> camera, std::shared_ptr<VoxelGrid> voxel_grid);
 
             void SetFrameDrawer(std::shared_ptr<IFrameDrawer> frame_drawer);
+            // gives up the first quality_level of the quality tiers
+            void SetQualityLevel(uint8_t quality_level);
 
             void DrawPixel(uint16_t x, uint16_t y, const RGBColor& color);
 
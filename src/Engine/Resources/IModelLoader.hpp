@@ -27,7 +27,12 @@ namespace Engine
             GenerationCondition normal_options;
             GenerationCondition tangent_options;
 
-            ModelLoadingOptions() : normal_options(GenerationCondition::IF_MISSING), tangent_options(GenerationCondition::IF_MISSING)
+            // merges duplicate vertices and reorders the vertices and indices to be cache friendly
+            bool optimize;
+            // simplified versions of the model, for when it's small on screen
+            bool generate_lods;
+
+            ModelLoadingOptions() : normal_options(GenerationCondition::IF_MISSING), tangent_options(GenerationCondition::IF_MISSING), optimize(true), generate_lods(true)
             {
             }
         };
@@ -0,0 +1,238 @@
+#include "MeshOptimizer.hpp"
+
+#include <bit>
+#include <limits>
+#include <unordered_map>
+
+namespace Engine
+{
+    namespace Resources
+    {
+        MeshOptimizer::MeshOptimizer()
+        {
+        }
+
+        uint64_t MeshOptimizer::GetVertexHash(const Vertex& vertex, uint64_t hash) const
+        {
+            const float values[] = {vertex.GetPosition().x,
+                                    vertex.GetPosition().y,
+                                    vertex.GetPosition().z,
+                                    vertex.GetW(),
+                                    vertex.GetNormal().x,
+                                    vertex.GetNormal().y,
+                                    vertex.GetNormal().z,
+                                    vertex.GetTextureCoords().x,
+                                    vertex.GetTextureCoords().y};
+
+            // fnv-1a over the bits of the attributes, tangents are left out since they are calculated from the others
+            for (float value : values)
+            {
+                hash ^= std::bit_cast<uint32_t>(value);
+                hash *= 1099511628211ull;
+            }
+
+            return hash;
+        }
+
+        bool MeshOptimizer::IsSameVertex(const Vertex& vertex, const Vertex& other) const
+        {
+            return vertex.GetPosition() == other.GetPosition() && vertex.GetW() == other.GetW() && vertex.GetNormal() == other.GetNormal() && vertex.GetTangent() == other.GetTangent() &&
+                   vertex.GetBitangent() == other.GetBitangent() && vertex.GetTextureCoords() == other.GetTextureCoords();
+        }
+
+        void MeshOptimizer::Optimize(const std::vector<std::reference_wrapper<std::vector<Vertex>>>& frames, std::vector<uint32_t>& indices) const
+        {
+            if (frames.empty() || indices.size() < 3)
+                return;
+
+            WeldVertices(frames, indices);
+            OptimizeVertexCache(indices, (uint32_t)frames.front().get().size());
+            OptimizeVertexFetch(frames, indices);
+        }
+
+        void MeshOptimizer::WeldVertices(const std::vector<std::reference_wrapper<std::vector<Vertex>>>& frames, std::vector<uint32_t>& indices) const
+        {
+            uint32_t vertex_count = (uint32_t)frames.front().get().size();
+
+            std::vector<uint32_t> welded_indices(vertex_count);
+            // the vertices with the same hash, the first one of each group of identical vertices is kept
+            std::unordered_map<uint64_t, std::vector<uint32_t>> buckets;
+
+            for (uint32_t i = 0; i < vertex_count; i++)
+            {
+                uint64_t hash = 14695981039346656037ull;
+
+                for (const std::vector<Vertex>& vertices : frames)
+                    hash = GetVertexHash(vertices[i], hash);
+
+                std::vector<uint32_t>& bucket = buckets[hash];
+
+                welded_indices[i] = i;
+
+                for (uint32_t candidate : bucket)
+                {
+                    bool is_same = true;
+
+                    for (const std::vector<Vertex>& vertices : frames)
+                    {
+                        if (!IsSameVertex(vertices[i], vertices[candidate]))
+                        {
+                            is_same = false;
+                            break;
+                        }
+                    }
+
+                    if (is_same)
+                    {
+                        welded_indices[i] = candidate;
+                        break;
+                    }
+                }
+
+                if (welded_indices[i] == i)
+                    bucket.push_back(i);
+            }
+
+            // the duplicates are left unused, they are dropped when the vertices are reordered
+            for (uint32_t& index : indices)
+                index = welded_indices[index];
+        }
+
+        void MeshOptimizer::OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertex_count) const
+        {
+            uint32_t triangle_count = (uint32_t)indices.size() / 3;
+
+            // the triangles using each vertex, and how many of them are not emitted yet
+            std::vector<std::vector<uint32_t>> vertex_triangles(vertex_count);
+            std::vector<uint32_t> live_triangles(vertex_count, 0);
+
+            for (uint32_t t = 0; t < triangle_count; t++)
+            {
+                for (uint32_t k = 0; k < 3; k++)
+                {
+                    vertex_triangles[indices[t * 3 + k]].push_back(t);
+                    live_triangles[indices[t * 3 + k]]++;
+                }
+            }
+
+            // when each vertex last entered the cache, a vertex is in the cache while timestamp - cache_time < vertex_cache_size
+            std::vector<uint32_t> cache_times(vertex_count, 0);
+            uint32_t timestamp = vertex_cache_size + 1;
+
+            std::vector<bool> emitted_triangles(triangle_count, false);
+            std::vector<uint32_t> dead_end_stack;
+            std::vector<uint32_t> optimized_indices;
+            optimized_indices.reserve(indices.size());
+
+            // the next vertex to try if the fanning gets stuck
+            uint32_t cursor = 0;
+            // all the triangles around the fanning vertex are emitted
+            int64_t fanning_vertex = 0;
+
+            while (fanning_vertex >= 0)
+            {
+                std::vector<uint32_t> candidates;
+
+                for (uint32_t t : vertex_triangles[fanning_vertex])
+                {
+                    if (emitted_triangles[t])
+                        continue;
+
+                    for (uint32_t k = 0; k < 3; k++)
+                    {
+                        uint32_t vertex = indices[t * 3 + k];
+
+                        optimized_indices.push_back(vertex);
+                        dead_end_stack.push_back(vertex);
+                        candidates.push_back(vertex);
+
+                        live_triangles[vertex]--;
+
+                        if (timestamp - cache_times[vertex] > vertex_cache_size)
+                        {
+                            cache_times[vertex] = timestamp;
+                            timestamp++;
+                        }
+                    }
+
+                    emitted_triangles[t] = true;
+                }
+
+                // the next fanning vertex is the one that will still be in the cache after all it's triangles are emitted, and that entered it first
+                fanning_vertex    = -1;
+                int64_t best_score = -1;
+
+                for (uint32_t vertex : candidates)
+                {
+                    if (live_triangles[vertex] == 0)
+                        continue;
+
+                    int64_t score = 0;
+
+                    if (timestamp - cache_times[vertex] + 2 * live_triangles[vertex] <= vertex_cache_size)
+                        score = timestamp - cache_times[vertex];
+
+                    if (score > best_score)
+                    {
+                        best_score     = score;
+                        fanning_vertex = vertex;
+                    }
+                }
+
+                if (fanning_vertex >= 0)
+                    continue;
+
+                // a dead end, first try the recently used vertices and then continue in the input order
+                while (!dead_end_stack.empty() && fanning_vertex < 0)
+                {
+                    uint32_t vertex = dead_end_stack.back();
+                    dead_end_stack.pop_back();
+
+                    if (live_triangles[vertex] > 0)
+                        fanning_vertex = vertex;
+                }
+
+                while (cursor < vertex_count && fanning_vertex < 0)
+                {
+                    if (live_triangles[cursor] > 0)
+                        fanning_vertex = cursor;
+
+                    cursor++;
+                }
+            }
+
+            indices = optimized_indices;
+        }
+
+        void MeshOptimizer::OptimizeVertexFetch(const std::vector<std::reference_wrapper<std::vector<Vertex>>>& frames, std::vector<uint32_t>& indices) const
+        {
+            uint32_t vertex_count = (uint32_t)frames.front().get().size();
+
+            std::vector<uint32_t> new_indices(vertex_count, std::numeric_limits<uint32_t>::max());
+            std::vector<uint32_t> old_indices;
+            old_indices.reserve(vertex_count);
+
+            for (uint32_t& index : indices)
+            {
+                if (new_indices[index] == std::numeric_limits<uint32_t>::max())
+                {
+                    new_indices[index] = (uint32_t)old_indices.size();
+                    old_indices.push_back(index);
+                }
+
+                index = new_indices[index];
+            }
+
+            for (std::vector<Vertex>& vertices : frames)
+            {
+                std::vector<Vertex> reordered_vertices;
+                reordered_vertices.reserve(old_indices.size());
+
+                for (uint32_t index : old_indices)
+                    reordered_vertices.push_back(vertices[index]);
+
+                vertices = reordered_vertices;
+            }
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef MESHOPTIMIZER_HPP
+#define MESHOPTIMIZER_HPP
+
+#include "Engine/Rendering/Vertex.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Engine
+{
+    namespace Resources
+    {
+        using namespace Rendering;
+
+        // reorders the vertices and indices of a loaded model so that shared vertices are transformed once and fetched close to each other,
+        // animated models pass all their frames since they all share the same indices
+        class MeshOptimizer
+        {
+        private:
+            // the size of the post transform vertex cache the triangles are ordered for
+            static constexpr uint32_t vertex_cache_size = 16;
+
+            [[nodiscard]] uint64_t GetVertexHash(const Vertex& vertex, uint64_t hash) const;
+            [[nodiscard]] bool IsSameVertex(const Vertex& vertex, const Vertex& other) const;
+
+        public:
+            MeshOptimizer();
+
+            void Optimize(const std::vector<std::reference_wrapper<std::vector<Vertex>>>& frames, std::vector<uint32_t>& indices) const;
+
+            // merges the vertices that are identical in every frame
+            void WeldVertices(const std::vector<std::reference_wrapper<std::vector<Vertex>>>& frames, std::vector<uint32_t>& indices) const;
+            // reorders the triangles for the post transform vertex cache (Tipsify, Sander et al.)
+            void OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertex_count) const;
+            // reorders the vertices in the order the triangles use them, unused vertices are dropped
+            void OptimizeVertexFetch(const std::vector<std::reference_wrapper<std::vector<Vertex>>>& frames, std::vector<uint32_t>& indices) const;
+        };
+    }
+}
+
+#endif
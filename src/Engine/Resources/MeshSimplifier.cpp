@@ -0,0 +1,377 @@
+#include "MeshSimplifier.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <queue>
+
+namespace Engine
+{
+    namespace Resources
+    {
+        MeshSimplifier::Quadric::Quadric() : a2(0), ab(0), ac(0), ad(0), b2(0), bc(0), bd(0), c2(0), cd(0), d2(0)
+        {
+        }
+
+        MeshSimplifier::Quadric::Quadric(const Vector3& normal, double d, double weight) :
+            a2(weight * normal.x * normal.x),
+            ab(weight * normal.x * normal.y),
+            ac(weight * normal.x * normal.z),
+            ad(weight * normal.x * d),
+            b2(weight * normal.y * normal.y),
+            bc(weight * normal.y * normal.z),
+            bd(weight * normal.y * d),
+            c2(weight * normal.z * normal.z),
+            cd(weight * normal.z * d),
+            d2(weight * d * d)
+        {
+        }
+
+        MeshSimplifier::Quadric& MeshSimplifier::Quadric::operator+=(const Quadric& other)
+        {
+            a2 += other.a2;
+            ab += other.ab;
+            ac += other.ac;
+            ad += other.ad;
+            b2 += other.b2;
+            bc += other.bc;
+            bd += other.bd;
+            c2 += other.c2;
+            cd += other.cd;
+            d2 += other.d2;
+
+            return *this;
+        }
+
+        double MeshSimplifier::Quadric::Evaluate(const Vector3& point) const
+        {
+            double x = point.x;
+            double y = point.y;
+            double z = point.z;
+
+            return a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x + b2 * y * y + 2 * bc * y * z + 2 * bd * y + c2 * z * z + 2 * cd * z + d2;
+        }
+
+        MeshSimplifier::MeshSimplifier()
+        {
+        }
+
+        std::vector<ModelLod> MeshSimplifier::GenerateLods(const std::vector<std::reference_wrapper<const std::vector<Vertex>>>& frames, const std::vector<uint32_t>& indices) const
+        {
+            std::vector<ModelLod> lods;
+
+            if (frames.empty() || indices.size() < 3)
+                return lods;
+
+            std::vector<std::reference_wrapper<const std::vector<Vertex>>> sampled_frames;
+
+            if (frames.size() <= max_sampled_frames)
+            {
+                sampled_frames = frames;
+            }
+            else
+            {
+                for (uint32_t i = 0; i < max_sampled_frames; i++)
+                    sampled_frames.push_back(frames[i * frames.size() / max_sampled_frames]);
+            }
+
+            uint32_t vertex_count       = (uint32_t)frames.front().get().size();
+            uint32_t triangle_count     = (uint32_t)indices.size() / 3;
+            uint32_t previous_triangles = triangle_count;
+
+            for (uint32_t level = 1; level <= max_lod_levels; level++)
+            {
+                uint32_t target_triangles = triangle_count >> level;
+
+                if (target_triangles < min_lod_triangles)
+                    break;
+
+                // every level is simplified from the full model, so the errors don't accumulate between levels
+                std::vector<uint32_t> simplified_indices = Simplify(sampled_frames, indices, target_triangles);
+                uint32_t simplified_triangles            = (uint32_t)simplified_indices.size() / 3;
+
+                // the collapses got stuck (i.e on open borders), there is no point in more levels
+                if (simplified_triangles > previous_triangles - previous_triangles / 10)
+                    break;
+
+                lods.push_back(GetCompacted(simplified_indices, vertex_count));
+
+                previous_triangles = simplified_triangles;
+            }
+
+            return lods;
+        }
+
+        std::vector<uint32_t> MeshSimplifier::Simplify(const std::vector<std::reference_wrapper<const std::vector<Vertex>>>& frames, const std::vector<uint32_t>& indices, uint32_t target_triangles) const
+        {
+            uint32_t frame_count    = (uint32_t)frames.size();
+            uint32_t vertex_count   = (uint32_t)frames.front().get().size();
+            uint32_t triangle_count = (uint32_t)indices.size() / 3;
+
+            std::vector<uint32_t> triangles = indices;
+            std::vector<bool> removed_triangles(triangle_count, false);
+            uint32_t remaining_triangles = triangle_count;
+
+            std::vector<std::vector<uint32_t>> vertex_triangles(vertex_count);
+
+            for (uint32_t t = 0; t < triangle_count; t++)
+            {
+                for (uint32_t k = 0; k < 3; k++)
+                    vertex_triangles[triangles[t * 3 + k]].push_back(t);
+            }
+
+            // one quadric per vertex per frame, since the vertex positions are different in each frame
+            std::vector<Quadric> quadrics(vertex_count * frame_count);
+
+            for (uint32_t f = 0; f < frame_count; f++)
+            {
+                const std::vector<Vertex>& vertices = frames[f].get();
+
+                for (uint32_t t = 0; t < triangle_count; t++)
+                {
+                    Vector3 p0 = vertices[triangles[t * 3]].GetPosition();
+                    Vector3 p1 = vertices[triangles[t * 3 + 1]].GetPosition();
+                    Vector3 p2 = vertices[triangles[t * 3 + 2]].GetPosition();
+
+                    Vector3 normal = (p1 - p0).GetCrossProduct(p2 - p0);
+                    float length   = normal.GetLength();
+
+                    if (length == 0)
+                        continue;
+
+                    normal /= length;
+
+                    // weighted by the area, so big triangles are harder to move away from
+                    Quadric quadric = Quadric(normal, -normal.GetDotProduct(p0), length * 0.5);
+
+                    for (uint32_t k = 0; k < 3; k++)
+                        quadrics[triangles[t * 3 + k] * frame_count + f] += quadric;
+                }
+            }
+
+            // vertices on open borders are never removed, so the holes don't grow
+            std::vector<bool> locked_vertices(vertex_count, false);
+            std::map<uint64_t, uint32_t> edge_usage;
+
+            for (uint32_t t = 0; t < triangle_count; t++)
+            {
+                for (uint32_t k = 0; k < 3; k++)
+                {
+                    uint64_t a = triangles[t * 3 + k];
+                    uint64_t b = triangles[t * 3 + (k + 1) % 3];
+
+                    edge_usage[(std::min(a, b) << 32) | std::max(a, b)]++;
+                }
+            }
+
+            for (const auto& [edge, usage] : edge_usage)
+            {
+                if (usage == 1)
+                {
+                    locked_vertices[(uint32_t)(edge >> 32)]        = true;
+                    locked_vertices[(uint32_t)(edge & 0xFFFFFFFF)] = true;
+                }
+            }
+
+            std::vector<uint32_t> versions(vertex_count, 0);
+            std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> collapses;
+
+            auto queue_collapse = [&](uint32_t from, uint32_t to)
+            {
+                if (locked_vertices[from])
+                    return;
+
+                double cost = 0;
+
+                // the removed vertex takes the position of the kept one in every frame
+                for (uint32_t f = 0; f < frame_count; f++)
+                {
+                    Quadric quadric = quadrics[from * frame_count + f];
+                    quadric += quadrics[to * frame_count + f];
+
+                    cost += quadric.Evaluate(frames[f].get()[to].GetPosition());
+                }
+
+                collapses.push({cost, from, to, versions[from], versions[to]});
+            };
+
+            auto queue_vertex_collapses = [&](uint32_t vertex)
+            {
+                for (uint32_t t : vertex_triangles[vertex])
+                {
+                    for (uint32_t k = 0; k < 3; k++)
+                    {
+                        uint32_t neighbour = triangles[t * 3 + k];
+
+                        if (neighbour == vertex)
+                            continue;
+
+                        queue_collapse(vertex, neighbour);
+                        queue_collapse(neighbour, vertex);
+                    }
+                }
+            };
+
+            auto get_neighbours = [&](uint32_t vertex)
+            {
+                std::vector<uint32_t> neighbours;
+
+                for (uint32_t t : vertex_triangles[vertex])
+                {
+                    for (uint32_t k = 0; k < 3; k++)
+                    {
+                        if (triangles[t * 3 + k] != vertex)
+                            neighbours.push_back(triangles[t * 3 + k]);
+                    }
+                }
+
+                std::sort(neighbours.begin(), neighbours.end());
+                neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+
+                return neighbours;
+            };
+
+            auto is_collapse_valid = [&](uint32_t from, uint32_t to)
+            {
+                // an edge can only collapse if the vertices share no neighbours except the two opposite to the edge, otherwise the mesh folds onto itself
+                std::vector<uint32_t> from_neighbours = get_neighbours(from);
+                std::vector<uint32_t> to_neighbours   = get_neighbours(to);
+                std::vector<uint32_t> shared_neighbours;
+
+                std::set_intersection(from_neighbours.begin(), from_neighbours.end(), to_neighbours.begin(), to_neighbours.end(), std::back_inserter(shared_neighbours));
+
+                if (shared_neighbours.size() > 2)
+                    return false;
+
+                // none of the triangles that stay may flip
+                for (uint32_t t : vertex_triangles[from])
+                {
+                    uint32_t* triangle = &triangles[t * 3];
+
+                    if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+                        continue;
+
+                    for (uint32_t f = 0; f < frame_count; f++)
+                    {
+                        const std::vector<Vertex>& vertices = frames[f].get();
+
+                        Vector3 positions[3];
+                        Vector3 moved_positions[3];
+
+                        for (uint32_t k = 0; k < 3; k++)
+                        {
+                            positions[k]       = vertices[triangle[k]].GetPosition();
+                            moved_positions[k] = vertices[triangle[k] == from ? to : triangle[k]].GetPosition();
+                        }
+
+                        Vector3 normal       = (positions[1] - positions[0]).GetCrossProduct(positions[2] - positions[0]);
+                        Vector3 moved_normal = (moved_positions[1] - moved_positions[0]).GetCrossProduct(moved_positions[2] - moved_positions[0]);
+
+                        if (normal.GetDotProduct(moved_normal) <= 0)
+                            return false;
+                    }
+                }
+
+                return true;
+            };
+
+            for (uint32_t t = 0; t < triangle_count; t++)
+            {
+                for (uint32_t k = 0; k < 3; k++)
+                {
+                    queue_collapse(triangles[t * 3 + k], triangles[t * 3 + (k + 1) % 3]);
+                    queue_collapse(triangles[t * 3 + (k + 1) % 3], triangles[t * 3 + k]);
+                }
+            }
+
+            while (remaining_triangles > target_triangles && !collapses.empty())
+            {
+                Collapse collapse = collapses.top();
+                collapses.pop();
+
+                if (versions[collapse.from] != collapse.from_version || versions[collapse.to] != collapse.to_version)
+                    continue;
+
+                if (!is_collapse_valid(collapse.from, collapse.to))
+                    continue;
+
+                for (uint32_t t : vertex_triangles[collapse.from])
+                {
+                    uint32_t* triangle = &triangles[t * 3];
+
+                    // the triangles on the collapsed edge disappear
+                    if (triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to)
+                    {
+                        removed_triangles[t] = true;
+                        remaining_triangles--;
+
+                        continue;
+                    }
+
+                    for (uint32_t k = 0; k < 3; k++)
+                    {
+                        if (triangle[k] == collapse.from)
+                            triangle[k] = collapse.to;
+                    }
+
+                    vertex_triangles[collapse.to].push_back(t);
+                }
+
+                vertex_triangles[collapse.from].clear();
+
+                // removed triangles are also dropped from the lists of the other vertices they were using
+                for (uint32_t vertex : get_neighbours(collapse.to))
+                    std::erase_if(vertex_triangles[vertex], [&](uint32_t t) { return removed_triangles[t]; });
+
+                std::erase_if(vertex_triangles[collapse.to], [&](uint32_t t) { return removed_triangles[t]; });
+
+                for (uint32_t f = 0; f < frame_count; f++)
+                    quadrics[collapse.to * frame_count + f] += quadrics[collapse.from * frame_count + f];
+
+                versions[collapse.from]++;
+                versions[collapse.to]++;
+
+                queue_vertex_collapses(collapse.to);
+            }
+
+            std::vector<uint32_t> simplified_indices;
+            simplified_indices.reserve(remaining_triangles * 3);
+
+            for (uint32_t t = 0; t < triangle_count; t++)
+            {
+                if (removed_triangles[t])
+                    continue;
+
+                simplified_indices.push_back(triangles[t * 3]);
+                simplified_indices.push_back(triangles[t * 3 + 1]);
+                simplified_indices.push_back(triangles[t * 3 + 2]);
+            }
+
+            return simplified_indices;
+        }
+
+        ModelLod MeshSimplifier::GetCompacted(const std::vector<uint32_t>& indices, uint32_t vertex_count) const
+        {
+            ModelLod lod;
+
+            std::vector<uint32_t> new_indices(vertex_count, std::numeric_limits<uint32_t>::max());
+
+            lod.indices.reserve(indices.size());
+
+            // the vertices are renumbered in the order they are first used
+            for (uint32_t index : indices)
+            {
+                if (new_indices[index] == std::numeric_limits<uint32_t>::max())
+                {
+                    new_indices[index] = (uint32_t)lod.vertex_remap.size();
+                    lod.vertex_remap.push_back(index);
+                }
+
+                lod.indices.push_back(new_indices[index]);
+            }
+
+            return lod;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef MESHSIMPLIFIER_HPP
+#define MESHSIMPLIFIER_HPP
+
+#include "Engine/Rendering/Vertex.hpp"
+#include "Math/Vector3.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Engine
+{
+    namespace Resources
+    {
+        using namespace Rendering;
+        using namespace Math;
+
+        // a simplified level of a model, it's vertices are a subset of the original ones
+        struct ModelLod
+        {
+            // the index of each vertex of the level in the original vertices
+            std::vector<uint32_t> vertex_remap;
+            std::vector<uint32_t> indices;
+        };
+
+        // generates levels of detail with quadric error edge collapses (Garland & Heckbert), a collapse always merges a vertex into one of it's
+        // neighbours so the kept vertices don't need their attributes recalculated, and for animated models the same collapses apply to every frame
+        class MeshSimplifier
+        {
+        private:
+            struct Quadric
+            {
+                double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+
+                Quadric();
+                Quadric(const Vector3& normal, double d, double weight);
+
+                Quadric& operator+=(const Quadric& other);
+
+                [[nodiscard]] double Evaluate(const Vector3& point) const;
+            };
+
+            struct Collapse
+            {
+                double cost;
+
+                uint32_t from;
+                uint32_t to;
+
+                // the versions of both vertices when the collapse was queued, if any of them changed since then the collapse is outdated
+                uint32_t from_version;
+                uint32_t to_version;
+
+                bool operator>(const Collapse& other) const
+                {
+                    return cost > other.cost;
+                }
+            };
+
+            // every level has half the triangles of the previous one
+            static constexpr uint32_t max_lod_levels = 4;
+            // levels under this are not worth it
+            static constexpr uint32_t min_lod_triangles = 32;
+            // the error of animated models is only measured on some of the frames, to keep the loading time reasonable
+            static constexpr uint32_t max_sampled_frames = 16;
+
+            [[nodiscard]] ModelLod GetCompacted(const std::vector<uint32_t>& indices, uint32_t vertex_count) const;
+
+        public:
+            MeshSimplifier();
+
+            [[nodiscard]] std::vector<ModelLod> GenerateLods(const std::vector<std::reference_wrapper<const std::vector<Vertex>>>& frames, const std::vector<uint32_t>& indices) const;
+
+            // returns the indices of the simplified mesh, they still point to the original vertices
+            [[nodiscard]] std::vector<uint32_t> Simplify(const std::vector<std::reference_wrapper<const std::vector<Vertex>>>& frames, const std::vector<uint32_t>& indices, uint32_t target_triangles) const;
+        };
+    }
+}
+
+#endif
@@ -24,7 +24,21 @@ namespace Engine
             return filename.substr(idx + 1);
         }
 
-        bool ResourceManager::LoadTexture(const std::string& filename, TextureLoadingOptions load_options, TextureWrapOptions wrap_options)
+        std::vector<std::reference_wrapper<std::vector<Vertex>>> ResourceManager::GetFramesVertices(std::vector<Frame>& frames) const
+        {
+            std::vector<std::reference_wrapper<std::vector<Vertex>>> frames_vertices;
+
+            for (Frame& frame : frames)
+                frames_vertices.push_back(*frame.vertices.get());
+
+            return frames_vertices;
+        }
+
+        bool ResourceManager::LoadTexture(const std::string& filename,
+                                          TextureLoadingOptions load_options,
+                                          TextureWrapOptions wrap_options,
+                                          TextureFilterOptions filter_options,
+                                          TextureCompressionOptions compression_options)
         {
             if (texture_cache.find(filename) != texture_cache.end())
                 return true;
@@ -50,7 +64,8 @@ namespace Engine
                         return false;
                 }
 
-                texture_cache.emplace(filename, std::make_shared<Texture>(imagebuffer, wrap_options));
+                // the mipmaps are generated here too, unless the texture is not filtered, and palettized if asked to
+                texture_cache.emplace(filename, std::make_shared<Texture>(imagebuffer, wrap_options, filter_options, compression_options));
 
                 return true;
             }
@@ -85,7 +100,29 @@ namespace Engine
                         return false;
                 }
 
-                static_model_cache.emplace(filename, std::make_shared<StaticModel>(obj_vertices, obj_indices));
+                if (options.optimize)
+                    mesh_optimizer.Optimize({obj_vertices}, obj_indices);
+
+                std::shared_ptr<StaticModel> model = std::make_shared<StaticModel>(obj_vertices, obj_indices);
+
+                if (options.generate_lods)
+                {
+                    for (ModelLod& lod : mesh_simplifier.GenerateLods({obj_vertices}, obj_indices))
+                    {
+                        std::vector<Vertex> lod_vertices;
+                        lod_vertices.reserve(lod.vertex_remap.size());
+
+                        for (uint32_t index : lod.vertex_remap)
+                            lod_vertices.push_back(obj_vertices[index]);
+
+                        if (options.optimize)
+                            mesh_optimizer.Optimize({lod_vertices}, lod.indices);
+
+                        model->AddLod(lod_vertices, lod.indices);
+                    }
+                }
+
+                static_model_cache.emplace(filename, model);
 
                 return true;
             }
@@ -105,7 +142,42 @@ namespace Engine
                         return false;
                 }
 
-                animated_model_cache.emplace(filename, std::make_shared<AnimatedModel>(md2_frames, md2_indices, md2_animations));
+                if (options.optimize)
+                    mesh_optimizer.Optimize(GetFramesVertices(md2_frames), md2_indices);
+
+                std::shared_ptr<AnimatedModel> model = std::make_shared<AnimatedModel>(md2_frames, md2_indices, md2_animations);
+
+                if (options.generate_lods)
+                {
+                    std::vector<std::reference_wrapper<const std::vector<Vertex>>> frame_vertices;
+
+                    for (const Frame& frame : md2_frames)
+                        frame_vertices.push_back(*frame.vertices.get());
+
+                    // the collapses are shared by all the frames, so every level can still be interpolated between it's frames
+                    for (ModelLod& lod : mesh_simplifier.GenerateLods(frame_vertices, md2_indices))
+                    {
+                        std::vector<Frame> lod_frames;
+
+                        for (const Frame& frame : md2_frames)
+                        {
+                            Frame lod_frame = {frame.name, std::make_shared<std::vector<Vertex>>()};
+                            lod_frame.vertices->reserve(lod.vertex_remap.size());
+
+                            for (uint32_t index : lod.vertex_remap)
+                                lod_frame.vertices->push_back(frame.vertices->at(index));
+
+                            lod_frames.push_back(lod_frame);
+                        }
+
+                        if (options.optimize)
+                            mesh_optimizer.Optimize(GetFramesVertices(lod_frames), lod.indices);
+
+                        model->AddLod(lod_frames, lod.indices);
+                    }
+                }
+
+                animated_model_cache.emplace(filename, model);
 
                 return true;
             }
@@ -152,5 +224,11 @@ namespace Engine
             return animated_model_cache.at(resource_name);
         }
 
+        void ResourceManager::ClearAnimationPoseCaches()
+        {
+            for (const auto& [resource_name, model] : animated_model_cache)
+                model->ClearPoseCache();
+        }
+
     }
 }
@@ -11,9 +11,12 @@
 #include "IModelLoader.hpp"
 #include "ITextureLoader.hpp"
 #include "Md2ModelLoader.hpp"
+#include "MeshOptimizer.hpp"
+#include "MeshSimplifier.hpp"
 #include "ObjModelLoader.hpp"
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
@@ -36,12 +39,20 @@ namespace Engine
             Md2ModelLoader model_loader_md2;
             BmpTextureLoader texture_loader_bmp;
 
+            MeshOptimizer mesh_optimizer;
+            MeshSimplifier mesh_simplifier;
+
             [[nodiscard]] std::string GetFileExtension(const std::string& filename) const;
+            [[nodiscard]] std::vector<std::reference_wrapper<std::vector<Vertex>>> GetFramesVertices(std::vector<Frame>& frames) const;
 
         public:
             ResourceManager();
 
-            bool LoadTexture(const std::string& filename, TextureLoadingOptions load_options, TextureWrapOptions wrap_options = TextureWrapOptions::BORDER);
+            bool LoadTexture(const std::string& filename,
+                             TextureLoadingOptions load_options,
+                             TextureWrapOptions wrap_options               = TextureWrapOptions::BORDER,
+                             TextureFilterOptions filter_options           = TextureFilterOptions::NEAREST,
+                             TextureCompressionOptions compression_options = TextureCompressionOptions::NONE);
             bool LoadModel(const std::string& filename, ModelLoadingOptions options);
             void LoadTexture(const std::string& resource_name, const Texture& texture);
             void LoadModel(const std::string& resource_name, const StaticModel& model);
@@ -50,6 +61,8 @@ namespace Engine
             [[nodiscard]] std::optional<std::shared_ptr<Texture>> GetLoadedTexture(const std::string& resource_name);
             [[nodiscard]] std::optional<std::shared_ptr<StaticModel>> GetLoadedStaticModel(const std::string& resource_name);
             [[nodiscard]] std::optional<std::shared_ptr<AnimatedModel>> GetLoadedAnimatedModel(const std::string& resource_name);
+
+            void ClearAnimationPoseCaches();
         };
     }
 }
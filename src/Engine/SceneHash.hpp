@@ -0,0 +1,31 @@
+#ifndef SCENEHASH_HPP
+#define SCENEHASH_HPP
+
+#include <cstdint>
+
+namespace Engine
+{
+    // folds the change counts and the settings of everything a game draws into one value with fnv-1a, so the engine can tell the scene is the
+    // same as in the last frame without the game keeping a copy of it
+    class SceneHash
+    {
+    private:
+        uint64_t hash = 14695981039346656037ull;
+
+    public:
+        SceneHash& Add(uint64_t value)
+        {
+            hash ^= value;
+            hash *= 1099511628211ull;
+
+            return *this;
+        }
+
+        [[nodiscard]] uint64_t Get() const
+        {
+            return hash;
+        }
+    };
+}
+
+#endif
@@ -44,6 +44,9 @@ namespace Engine
     private:
         std::array<VoxelData, VOXEL_GRID_WIDTH * VOXEL_GRID_HEIGHT * VOXEL_GRID_DEPTH> grid;
 
+        // only the changes that can be seen are counted, the simulation rewrites the voxels it processes every update
+        uint32_t change_count = 0;
+
         constexpr uint32_t GetIndexFromCoords(Vector3I pos) const
         {
             pos.x += VOXEL_GRID_WIDTH / 2;
@@ -84,7 +87,18 @@ namespace Engine
 
         void SetVoxelData(const Vector3I& pos, const VoxelData& voxel_data)
         {
-            grid[GetIndexFromCoords(pos)] = voxel_data;
+            VoxelData& cur_voxel_data = grid[GetIndexFromCoords(pos)];
+
+            if (cur_voxel_data.type != voxel_data.type || cur_voxel_data.color_index != voxel_data.color_index)
+                change_count++;
+
+            cur_voxel_data = voxel_data;
+        }
+
+        // goes up whenever the type or color of a voxel changes
+        [[nodiscard]] uint32_t GetChangeCount() const
+        {
+            return change_count;
         }
 
         [[nodiscard]] constexpr bool IsPositionInsideGrid(int x, int y, int z) const
@@ -105,6 +119,7 @@ namespace Engine
         void Fill(VoxelData voxel_data)
         {
             grid.fill(voxel_data);
+            change_count++;
         }
     };
 }
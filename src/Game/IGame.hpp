@@ -2,10 +2,12 @@
 #define IGAME_HPP
 
 #include "../Display/IFrameDrawer.hpp"
+#include "../Engine/Rendering/QualityTier.hpp"
 
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <span>
 
 namespace Game
 {
@@ -20,6 +22,14 @@ namespace Game
         virtual void Update()                                                            = 0;
         virtual std::chrono::milliseconds Render(int64_t delta)                          = 0;
         virtual std::string GetDesiredWindowTitle() const                                = 0;
+
+        // a hash of the change counts of everything the game draws, the engine doesn't draw a frame when it's the same as for the last one
+        virtual uint64_t GetSceneHash() const = 0;
+
+        // the quality tiers of the renderers the game draws with, in the order they are given up when the frames are too slow
+        virtual std::span<const Engine::Rendering::QualityTier> GetQualityTiers() const = 0;
+        // gives up the first quality_level of the tiers, the game has to keep it through recreating its renderers
+        virtual void SetQualityLevel(uint8_t quality_level) = 0;
     };
 }
 
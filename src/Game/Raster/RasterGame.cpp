@@ -1,5 +1,6 @@
 #include "RasterGame.hpp"
 
+#include "Engine/SceneHash.hpp"
 #include "Math/Util/MathUtil.hpp"
 
 namespace Game
@@ -34,16 +35,17 @@ namespace Game
             resource_manager->LoadModel("../res/penguin.md2", model_options);
             resource_manager->LoadModel("../res/centaur.md2", model_options);
 
-            resource_manager->LoadTexture("../res/tiles.bmp", TextureLoadingOptions::DEFAULT);
+            // the skins and the floor don't need exact colors, a palette takes a quarter of the memory
+            resource_manager->LoadTexture("../res/tiles.bmp", TextureLoadingOptions::DEFAULT, TextureWrapOptions::BORDER, TextureFilterOptions::TRILINEAR, TextureCompressionOptions::PALETTE);
             resource_manager->LoadTexture("../res/tnt.bmp", TextureLoadingOptions::DEFAULT);
             resource_manager->LoadTexture("../res/text.bmp", TextureLoadingOptions::DEFAULT);
-            resource_manager->LoadTexture("../res/bricks.bmp", TextureLoadingOptions::FLIP_Y);
-            resource_manager->LoadTexture("../res/bricks_norm.bmp", TextureLoadingOptions::DEFAULT);
-            resource_manager->LoadTexture("../res/raptor.bmp", TextureLoadingOptions::FLIP_Y);
-            resource_manager->LoadTexture("../res/penguin.bmp", TextureLoadingOptions::FLIP_Y);
-            resource_manager->LoadTexture("../res/centaur.bmp", TextureLoadingOptions::FLIP_Y);
-            resource_manager->LoadTexture("../res/earth.bmp", TextureLoadingOptions::DEFAULT);
-            resource_manager->LoadTexture("../res/normalmap.bmp", TextureLoadingOptions::DEFAULT);
+            resource_manager->LoadTexture("../res/bricks.bmp", TextureLoadingOptions::FLIP_Y, TextureWrapOptions::BORDER, TextureFilterOptions::TRILINEAR);
+            resource_manager->LoadTexture("../res/bricks_norm.bmp", TextureLoadingOptions::DEFAULT, TextureWrapOptions::BORDER, TextureFilterOptions::TRILINEAR);
+            resource_manager->LoadTexture("../res/raptor.bmp", TextureLoadingOptions::FLIP_Y, TextureWrapOptions::BORDER, TextureFilterOptions::TRILINEAR, TextureCompressionOptions::PALETTE);
+            resource_manager->LoadTexture("../res/penguin.bmp", TextureLoadingOptions::FLIP_Y, TextureWrapOptions::BORDER, TextureFilterOptions::TRILINEAR, TextureCompressionOptions::PALETTE);
+            resource_manager->LoadTexture("../res/centaur.bmp", TextureLoadingOptions::FLIP_Y, TextureWrapOptions::BORDER, TextureFilterOptions::TRILINEAR, TextureCompressionOptions::PALETTE);
+            resource_manager->LoadTexture("../res/earth.bmp", TextureLoadingOptions::DEFAULT, TextureWrapOptions::BORDER, TextureFilterOptions::TRILINEAR);
+            resource_manager->LoadTexture("../res/normalmap.bmp", TextureLoadingOptions::DEFAULT, TextureWrapOptions::BORDER, TextureFilterOptions::TRILINEAR);
         }
 
         RasterGame::RasterGame(std::shared_ptr<IInputManager> input_manager) :
@@ -108,29 +110,30 @@ namespace Game
                 .SetScale(Vector3(12, 12, 12))
                 //
                 .SetPosition(Vector3(-26, -2, -26));
-            regular_bunny = StaticMesh();
-            regular_bunny.SetModelResource("../res/bunny.obj")
+            bunny = StaticMesh();
+            bunny.SetModelResource("../res/bunny.obj");
+            // regular
+            bunny_instances[0]
                 .SetPosition(Vector3(-20, -2, -24))
                 .SetColor(RGBColor(255, 255, 255))
-                //
                 .SetRotation(Angle(0, 3.14159f / 2 * 4, 0))
                 .SetScale(Vector3(10.0f, 10.0f, 10.0f));
-            metal_bunny = StaticMesh();
-            metal_bunny.SetModelResource("../res/bunny.obj")
+            // metal
+            bunny_instances[1]
                 .SetPosition(Vector3(-23, -2, -20))
                 .SetColor(RGBColor(255, 0, 00))
                 .SetRotation(Angle(0, 3.14159f / 2 * 4, 0))
                 .SetScale(Vector3(10.0f, 10.0f, 10.0f))
                 .SetMaterialProperties(MaterialProperties(20.0f, 1.6f));
-            shiny_bunny = StaticMesh();
-            shiny_bunny.SetModelResource("../res/bunny.obj")
+            // shiny
+            bunny_instances[2]
                 .SetPosition(Vector3(-17, -2, -20))
                 .SetColor(RGBColor(0, 255, 0))
                 .SetRotation(Angle(0, 3.14159f / 2 * 4, 0))
                 .SetScale(Vector3(10.0f, 10.0f, 10.0f))
                 .SetMaterialProperties(MaterialProperties(5.0f, 5.4f));
-            rough_bunny = StaticMesh();
-            rough_bunny.SetModelResource("../res/bunny.obj")
+            // rough
+            bunny_instances[3]
                 .SetPosition(Vector3(-20, -2, -16))
                 .SetColor(RGBColor(0, 0, 255))
                 .SetRotation(Angle(0, 3.14159f / 2 * 4, 0))
@@ -236,6 +239,9 @@ namespace Game
 
             scene_renderer = RasterSceneRenderer(resource_manager, lighting_system, camera);
             scene_renderer.SetFrameDrawer(this->frame_drawer);
+            scene_renderer.SetShadingOptions(shading_options);
+            scene_renderer.SetPerPixelShadowsEnabled(per_pixel_shadows_enabled);
+            scene_renderer.SetQualityLevel(quality_level);
         };
 
         void RasterGame::HandleInput()
@@ -312,6 +318,25 @@ namespace Game
                 marvin.PlayAnimation("taunt", 1.0f);
             }
 
+            // G switches between per pixel and per vertex lighting, H between per pixel and per vertex shadows in per vertex lighting
+            if (input_manager->IsKeyHeld(Key::G) && !changed_shading)
+            {
+                shading_options = shading_options == ShadingOptions::PER_PIXEL ? ShadingOptions::PER_VERTEX : ShadingOptions::PER_PIXEL;
+
+                scene_renderer.SetShadingOptions(shading_options);
+                changed_shading = true;
+            }
+            if (input_manager->IsKeyHeld(Key::H) && !changed_shading)
+            {
+                per_pixel_shadows_enabled = !per_pixel_shadows_enabled;
+
+                scene_renderer.SetPerPixelShadowsEnabled(per_pixel_shadows_enabled);
+                changed_shading = true;
+            }
+
+            if (!input_manager->IsKeyHeld(Key::G) && !input_manager->IsKeyHeld(Key::H))
+                changed_shading = false;
+
             if (input_manager->IsKeyHeld(Key::N1))
                 second_floor_enabled = true;
 
@@ -349,10 +374,8 @@ namespace Game
             // anim_mesh2.SetPosition(Vector3(std::sin(i + 2) * 2, -0.9f, std::cos(i + 2) * 2));
             // anim_mesh3.SetPosition(Vector3(std::sin(i + 4) * 2, -0.9f, std::cos(i + 4) * 2));
 
-            regular_bunny.SetRotation(Angle(0, i, 0));
-            metal_bunny.SetRotation(Angle(0, i, 0));
-            shiny_bunny.SetRotation(Angle(0, i, 0));
-            rough_bunny.SetRotation(Angle(0, i, 0));
+            for (MeshInstance& bunny_instance : bunny_instances)
+                bunny_instance.SetRotation(Angle(0, i, 0));
 
             thanks_for_watching.SetScale(Vector3(std::abs(std::sin(i / 2.0f)) * 0.1f + 0.05f, 0.1f, 0.1f));
             github_desc.SetScale(Vector3(std::abs(std::sin(i / 2.0f)) * 0.1f + 0.05f, 0.1f, 0.1f));
@@ -380,10 +403,7 @@ namespace Game
             if (third_floor_enabled)
             {
                 scene_renderer.DrawShadedMesh(third_floor);
-                scene_renderer.DrawShadedMesh(regular_bunny);
-                scene_renderer.DrawShadedMesh(metal_bunny);
-                scene_renderer.DrawShadedMesh(shiny_bunny);
-                scene_renderer.DrawShadedMesh(rough_bunny);
+                scene_renderer.DrawShadedMeshInstanced(bunny, bunny_instances);
             }
 
             if (fourth_floor_enabled)
@@ -450,5 +470,52 @@ namespace Game
         {
             return "Raster game";
         }
+
+        uint64_t RasterGame::GetSceneHash() const
+        {
+            SceneHash scene_hash;
+
+            scene_hash.Add(camera->GetChangeCount()).Add(lighting_system->GetChangeCount());
+            scene_hash.Add((uint64_t)shading_options).Add(per_pixel_shadows_enabled);
+            scene_hash.Add(first_floor_enabled).Add(second_floor_enabled).Add(third_floor_enabled).Add(fourth_floor_enabled).Add(fifth_floor_enabled);
+
+            // the meshes of the hidden floors can change without it showing
+            if (first_floor_enabled)
+                scene_hash.Add(first_floor.GetChangeCount()).Add(marvin.GetChangeCount()).Add(buggy.GetChangeCount());
+
+            if (second_floor_enabled)
+                scene_hash.Add(second_floor.GetChangeCount()).Add(earth.GetChangeCount()).Add(wall.GetChangeCount());
+
+            if (third_floor_enabled)
+            {
+                scene_hash.Add(third_floor.GetChangeCount()).Add(bunny.GetChangeCount());
+
+                for (const MeshInstance& bunny_instance : bunny_instances)
+                    scene_hash.Add(bunny_instance.GetChangeCount());
+            }
+
+            if (fourth_floor_enabled)
+            {
+                scene_hash.Add(fourth_floor.GetChangeCount()).Add(regular_wall.GetChangeCount()).Add(normal_map_wall.GetChangeCount());
+                scene_hash.Add(brick_wall.GetChangeCount()).Add(normal_map_brick_wall.GetChangeCount());
+            }
+
+            if (fifth_floor_enabled)
+                scene_hash.Add(thanks_for_watching.GetChangeCount()).Add(github_desc.GetChangeCount());
+
+            return scene_hash.Get();
+        }
+
+        std::span<const QualityTier> RasterGame::GetQualityTiers() const
+        {
+            return RasterSceneRenderer::quality_tiers;
+        }
+
+        void RasterGame::SetQualityLevel(uint8_t quality_level)
+        {
+            this->quality_level = quality_level;
+
+            scene_renderer.SetQualityLevel(quality_level);
+        }
     }
 }
@@ -12,6 +12,7 @@
 #include "Engine/Rendering/Lighting/LightingSystem.hpp"
 #include "Engine/Rendering/Lighting/PointLight.hpp"
 #include "Engine/Rendering/Lighting/SpotLight.hpp"
+#include "Engine/Rendering/MeshInstance.hpp"
 #include "Engine/Rendering/RasterSceneRenderer.hpp"
 #include "Engine/Rendering/Rasterizer.hpp"
 #include "Engine/Rendering/StaticMesh.hpp"
@@ -21,9 +22,11 @@
 #include "Math/Vector3.hpp"
 #include "ModelGenerator.hpp"
 
+#include <array>
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <span>
 
 namespace Game
 {
@@ -49,6 +52,11 @@ namespace Game
             std::shared_ptr<Camera> camera;
 
             RasterSceneRenderer scene_renderer;
+            // the renderer is recreated with the frame drawer, so the shading it uses is kept here
+            ShadingOptions shading_options = ShadingOptions::PER_PIXEL;
+            bool per_pixel_shadows_enabled = true;
+            bool changed_shading           = false;
+            uint8_t quality_level          = 0;
 
             bool first_floor_enabled = true;
             StaticMesh first_floor;
@@ -62,10 +70,9 @@ namespace Game
 
             bool third_floor_enabled = false;
             StaticMesh third_floor;
-            StaticMesh regular_bunny;
-            StaticMesh metal_bunny;
-            StaticMesh shiny_bunny;
-            StaticMesh rough_bunny;
+            // the regular, metal, shiny and rough bunnies share the same model, so they are drawn as instances of one mesh
+            StaticMesh bunny;
+            std::array<MeshInstance, 4> bunny_instances;
 
             bool fourth_floor_enabled = false;
             StaticMesh fourth_floor;
@@ -100,6 +107,10 @@ namespace Game
             virtual void Update() override;
             virtual std::chrono::milliseconds Render(int64_t delta) override;
             virtual std::string GetDesiredWindowTitle() const override;
+            virtual uint64_t GetSceneHash() const override;
+
+            virtual std::span<const QualityTier> GetQualityTiers() const override;
+            virtual void SetQualityLevel(uint8_t quality_level) override;
         };
     }
 }
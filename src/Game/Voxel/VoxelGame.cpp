@@ -3,9 +3,11 @@
 #include "../Voxel/VoxelSimulation.hpp"
 #include "../Voxel/VoxelUtil.hpp"
 #include "Display/RGBColor.hpp"
+#include "Engine/SceneHash.hpp"
 #include "Math/Util/MathUtil.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <random>
 #include <vector>
 
@@ -81,6 +83,7 @@ namespace Game
             raster_scene_renderer = RasterSceneRenderer(resource_manager, lighting_system, camera);
             voxel_scene_renderer.SetFrameDrawer(this->frame_drawer);
             raster_scene_renderer.SetFrameDrawer(this->frame_drawer);
+            voxel_scene_renderer.SetQualityLevel(quality_level);
         };
 
         void VoxelGame::LoadResources()
@@ -242,6 +245,8 @@ namespace Game
             cursor_center_grid_pos = voxel_grid->GetGridPosition(camera->GetPosition() + (camera->GetLookDirection() * cursor_depth));
             bool cursor_was_set    = false;
 
+            uint32_t change_count_before_cursor = voxel_grid->GetChangeCount();
+
             for (uint8_t i = 0; i < static_cast<uint8_t>(cursor_size); i++)
             {
                 for (const Vector3I& cursor_offset : VoxelUtil::sides_at_dist[i])
@@ -280,6 +285,8 @@ namespace Game
                 }
             }
 
+            cursor_change_count += voxel_grid->GetChangeCount() - change_count_before_cursor;
+
             return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - time);
         }
 
@@ -287,5 +294,28 @@ namespace Game
         {
             return voxel_element_name_map.at(selected_voxel);
         }
+
+        uint64_t VoxelGame::GetSceneHash() const
+        {
+            SceneHash scene_hash;
+
+            scene_hash.Add(camera->GetChangeCount()).Add(lighting_system->GetChangeCount()).Add(voxel_grid->GetChangeCount() - cursor_change_count);
+            // the cursor is placed in front of the camera
+            scene_hash.Add(std::bit_cast<uint32_t>(cursor_depth)).Add(std::bit_cast<uint32_t>(cursor_size));
+
+            return scene_hash.Get();
+        }
+
+        std::span<const QualityTier> VoxelGame::GetQualityTiers() const
+        {
+            return VoxelSceneRenderer::quality_tiers;
+        }
+
+        void VoxelGame::SetQualityLevel(uint8_t quality_level)
+        {
+            this->quality_level = quality_level;
+
+            voxel_scene_renderer.SetQualityLevel(quality_level);
+        }
     }
-}
\ No newline at end of file
+}
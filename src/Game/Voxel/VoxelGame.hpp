@@ -26,6 +26,7 @@
 #include <cstdint>
 #include <memory>
 #include <queue>
+#include <span>
 #include <vector>
 
 namespace Game
@@ -56,6 +57,8 @@ namespace Game
 
             VoxelSceneRenderer voxel_scene_renderer;
             RasterSceneRenderer raster_scene_renderer;
+            // the renderers are recreated with the frame drawer, so the quality level is kept here
+            uint8_t quality_level = 0;
 
             Raster::ModelGenerator model_generator;
             virtual void LoadResources() override;
@@ -74,6 +77,8 @@ namespace Game
             std::queue<VoxelData> prev_cursor_data;
             float cursor_depth = 5.0f;
             float cursor_size  = 1.0f;
+            // the cursor is drawn by changing the grid for the render, those changes don't change the scene
+            uint32_t cursor_change_count = 0;
 
             VoxelElement selected_voxel = VoxelElement::SAND;
 
@@ -88,6 +93,10 @@ namespace Game
             virtual void Update() override;
             virtual std::chrono::milliseconds Render(int64_t delta) override;
             virtual std::string GetDesiredWindowTitle() const override;
+            virtual uint64_t GetSceneHash() const override;
+
+            virtual std::span<const QualityTier> GetQualityTiers() const override;
+            virtual void SetQualityLevel(uint8_t quality_level) override;
         };
     }
 }
@@ -277,8 +277,21 @@ namespace Math
         return *this;
     }
 
-    // http://www.mesa3d.org/
+    bool Matrix4::IsAffine() const
+    {
+        return values[3][0] == 0 && values[3][1] == 0 && values[3][2] == 0 && values[3][3] == 1;
+    }
+
     Matrix4& Matrix4::Invert()
+    {
+        if (IsAffine())
+            return InvertAffine();
+
+        return InvertGeneral();
+    }
+
+    // http://www.mesa3d.org/
+    Matrix4& Matrix4::InvertGeneral()
     {
         float inv_mat[4][4];
         float determinant;
@@ -350,6 +363,57 @@ namespace Math
         return *this;
     }
 
+    // Invert with the bottom row of 0 0 0 1 put in, the terms are kept in the same order so the results are the same
+    Matrix4& Matrix4::InvertAffine()
+    {
+        float inv_mat[4][4];
+        float determinant;
+
+        inv_mat[0][0] = values[1][1] * values[2][2] - values[2][1] * values[1][2];
+        inv_mat[1][0] = -values[1][0] * values[2][2] + values[2][0] * values[1][2];
+        inv_mat[2][0] = values[1][0] * values[2][1] - values[2][0] * values[1][1];
+
+        inv_mat[0][1] = -values[0][1] * values[2][2] + values[2][1] * values[0][2];
+        inv_mat[1][1] = values[0][0] * values[2][2] - values[2][0] * values[0][2];
+        inv_mat[2][1] = -values[0][0] * values[2][1] + values[2][0] * values[0][1];
+
+        inv_mat[0][2] = values[0][1] * values[1][2] - values[1][1] * values[0][2];
+        inv_mat[1][2] = -values[0][0] * values[1][2] + values[1][0] * values[0][2];
+        inv_mat[2][2] = values[0][0] * values[1][1] - values[1][0] * values[0][1];
+
+        inv_mat[0][3] = -values[0][1] * values[1][2] * values[2][3] + values[0][1] * values[1][3] * values[2][2] + values[1][1] * values[0][2] * values[2][3] - values[1][1] * values[0][3] * values[2][2]
+                        - values[2][1] * values[0][2] * values[1][3] + values[2][1] * values[0][3] * values[1][2];
+
+        inv_mat[1][3] = values[0][0] * values[1][2] * values[2][3] - values[0][0] * values[1][3] * values[2][2] - values[1][0] * values[0][2] * values[2][3] + values[1][0] * values[0][3] * values[2][2]
+                        + values[2][0] * values[0][2] * values[1][3] - values[2][0] * values[0][3] * values[1][2];
+
+        inv_mat[2][3] = -values[0][0] * values[1][1] * values[2][3] + values[0][0] * values[1][3] * values[2][1] + values[1][0] * values[0][1] * values[2][3] - values[1][0] * values[0][3] * values[2][1]
+                        - values[2][0] * values[0][1] * values[1][3] + values[2][0] * values[0][3] * values[1][1];
+
+        inv_mat[3][3] = values[0][0] * values[1][1] * values[2][2] - values[0][0] * values[1][2] * values[2][1] - values[1][0] * values[0][1] * values[2][2] + values[1][0] * values[0][2] * values[2][1]
+                        + values[2][0] * values[0][1] * values[1][2] - values[2][0] * values[0][2] * values[1][1];
+
+        determinant = values[0][0] * inv_mat[0][0] + values[0][1] * inv_mat[1][0] + values[0][2] * inv_mat[2][0];
+
+        // matrix isn't invertible, just return the same matrix
+        if (determinant == 0)
+            return *this;
+
+        determinant = 1.0f / determinant;
+
+        for (int y = 0; y < 3; y++)
+        {
+            for (int x = 0; x < 4; x++)
+            {
+                values[y][x] = inv_mat[y][x] * determinant;
+            }
+        }
+
+        values[3][3] = inv_mat[3][3] * determinant;
+
+        return *this;
+    }
+
     Matrix4 Matrix4::GetInverted() const
     {
         return Matrix4(*this).Invert();
@@ -1,6 +1,8 @@
 #ifndef MATRIX4_HPP
 #define MATRIX4_HPP
 
+#include "Math/Util/SIMD.hpp"
+
 #include <algorithm>
 #include <cstdint>
 
@@ -12,7 +14,8 @@ namespace Math
     class Matrix4
     {
     public:
-        float values[4][4];
+        // aligned so each row loads as one SSE register
+        alignas(16) float values[4][4];
 
         Matrix4();
         Matrix4(float values[4][4]);
@@ -32,25 +35,49 @@ namespace Math
          */
         Matrix4& SetTBNMatrix(const Vector3& tangent, const Vector3& bitangent, const Vector3 normal);
 
+        // InvertAffine when the matrix is affine, InvertGeneral otherwise
         Matrix4& Invert();
+        Matrix4& InvertGeneral();
+        // for matrices with a bottom row of 0 0 0 1 (translations, rotations, scales and the view matrices made of them), the same result as
+        // InvertGeneral without the terms that are always 0, bit for bit except that a 0 can have the other sign: the bottom row is kept as 0 0 0
+        // and InvertGeneral can make -0 there, and a 0 of InvertGeneral that got a -0 term added can be -0 where InvertAffine's is +0
+        Matrix4& InvertAffine();
         Matrix4& Transpose();
 
+        [[nodiscard]] bool IsAffine() const;
+
         Matrix4 GetInverted() const;
         Matrix4 GetTransposed() const;
 
         [[nodiscard]] Matrix4 operator*(const Matrix4& other) const noexcept
         {
-            float new_values[4][4];
+            Matrix4 new_mat;
 
+#ifdef MATH_SSE
+            // each row is the sum of the rows of the other matrix scaled by the elements of the row of this one, added in the same order as below so
+            // the results are the same
+            __m128 other_rows[4] = {_mm_load_ps(other.values[0]), _mm_load_ps(other.values[1]), _mm_load_ps(other.values[2]), _mm_load_ps(other.values[3])};
+
+            for (uint8_t y = 0; y < 4; y++)
+            {
+                __m128 new_row = _mm_mul_ps(_mm_set1_ps(values[y][0]), other_rows[0]);
+                new_row        = _mm_add_ps(new_row, _mm_mul_ps(_mm_set1_ps(values[y][1]), other_rows[1]));
+                new_row        = _mm_add_ps(new_row, _mm_mul_ps(_mm_set1_ps(values[y][2]), other_rows[2]));
+                new_row        = _mm_add_ps(new_row, _mm_mul_ps(_mm_set1_ps(values[y][3]), other_rows[3]));
+
+                _mm_store_ps(new_mat.values[y], new_row);
+            }
+#else
             for (uint8_t y = 0; y < 4; y++)
             {
                 for (uint8_t x = 0; x < 4; x++)
                 {
-                    new_values[y][x] = values[y][0] * other.values[0][x] + values[y][1] * other.values[1][x] + values[y][2] * other.values[2][x] + values[y][3] * other.values[3][x];
+                    new_mat.values[y][x] = values[y][0] * other.values[0][x] + values[y][1] * other.values[1][x] + values[y][2] * other.values[2][x] + values[y][3] * other.values[3][x];
                 }
             }
+#endif
 
-            return Matrix4(new_values);
+            return new_mat;
         }
 
         Matrix4& operator*=(const Matrix4& other) noexcept
@@ -61,6 +88,22 @@ namespace Math
 
             return *this;
         }
+
+#ifdef MATH_SSE
+        // the matrix times a column vector, each row is multiplied with the vector and the products are transposed so they can be summed a column at
+        // a time, which adds them in the same order as the scalar versions
+        [[nodiscard]] inline __m128 Transform(__m128 vec) const noexcept
+        {
+            __m128 products0 = _mm_mul_ps(_mm_load_ps(values[0]), vec);
+            __m128 products1 = _mm_mul_ps(_mm_load_ps(values[1]), vec);
+            __m128 products2 = _mm_mul_ps(_mm_load_ps(values[2]), vec);
+            __m128 products3 = _mm_mul_ps(_mm_load_ps(values[3]), vec);
+
+            _MM_TRANSPOSE4_PS(products0, products1, products2, products3);
+
+            return _mm_add_ps(_mm_add_ps(_mm_add_ps(products0, products1), products2), products3);
+        }
+#endif
     };
 }
 
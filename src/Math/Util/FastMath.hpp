@@ -0,0 +1,109 @@
+#ifndef FASTMATH_HPP
+#define FASTMATH_HPP
+
+#include "Math/Util/SIMD.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// set by the FAST_MATH_ACCURACY cmake option, 0 is exact, 1 high and 2 low
+#ifndef FAST_MATH_ACCURACY
+#define FAST_MATH_ACCURACY 1
+#endif
+
+namespace Math
+{
+    namespace Util
+    {
+        enum class FastMathAccuracy
+        {
+            // the standard library functions
+            EXACT,
+            // rsqrt within 4e-7 (relative, 8.3e-7 without SSE), pow tables of 1024 entries, x^20 within 5e-5
+            HIGH,
+            // rsqrt within 3.7e-4 (relative, the most the SSE estimate is allowed to be off, 6.6e-4 without SSE), pow tables of 128 entries, x^20 within 3e-3
+            LOW
+        };
+
+        constexpr FastMathAccuracy fast_math_accuracy = static_cast<FastMathAccuracy>(FAST_MATH_ACCURACY);
+
+        // the SSE estimate where it's available, otherwise one from the bits of the float, with a newton step for the high accuracy, 0 gives a large
+        // finite value at every accuracy so normalizing a zero vector stays zero
+        template<FastMathAccuracy accuracy = fast_math_accuracy>
+        [[nodiscard]] inline static float FastRSqrt(float value) noexcept
+        {
+            value = std::max(value, std::numeric_limits<float>::min());
+
+            if constexpr (accuracy == FastMathAccuracy::EXACT)
+                return 1.0f / std::sqrt(value);
+
+#ifdef MATH_SSE
+            float result = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+#else
+            float result = std::bit_cast<float>(0x5F1FFFF9 - (std::bit_cast<uint32_t>(value) >> 1));
+
+            // a newton step with constants tuned so the error is centered instead of always below (Kadlec)
+            result *= 0.703952253f * (2.38924456f - value * result * result);
+#endif
+
+            if constexpr (accuracy == FastMathAccuracy::HIGH)
+                result *= 1.5f - 0.5f * value * result * result;
+
+            return result;
+        }
+
+        // x^exponent for x in [0, 1], sampled once and interpolated linearly, for exponents that stay the same for many calls like the specular
+        // factor of a material, the error grows with the exponent
+        template<FastMathAccuracy accuracy = fast_math_accuracy>
+        class PowTable
+        {
+        private:
+            static constexpr uint32_t size = accuracy == FastMathAccuracy::LOW ? 128 : 1024;
+
+            float exponent;
+            // one more entry than needed, so a base of 1 can interpolate with the one after it
+            std::vector<float> values;
+
+        public:
+            PowTable(float exponent) : exponent(exponent)
+            {
+                if constexpr (accuracy == FastMathAccuracy::EXACT)
+                    return;
+
+                values.resize(size + 2);
+
+                for (uint32_t i = 0; i <= size; i++)
+                    values[i] = std::pow((float)i / size, exponent);
+
+                values[size + 1] = values[size];
+            }
+
+            // bases outside of [0, 1] are clamped
+            [[nodiscard]] inline float Get(float base) const noexcept
+            {
+                base = std::min(std::max(0.0f, base), 1.0f);
+
+                if constexpr (accuracy == FastMathAccuracy::EXACT)
+                    return std::pow(base, exponent);
+
+                float position = base * size;
+                uint32_t index = (uint32_t)position;
+                float t        = position - (float)index;
+
+                return values[index] + (values[index + 1] - values[index]) * t;
+            }
+        };
+
+        // truncates like a cast, without the branches of a clamp, NaN is 0
+        [[nodiscard]] constexpr inline static uint8_t ClampToByte(float value) noexcept
+        {
+            return (uint8_t)std::min(std::max(0.0f, value), 255.0f);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+// whether the math types are built with SSE, which is always there on x64, MATH_NO_SIMD (the MATH_SIMD cmake option) forces the scalar versions
+#ifndef MATH_NO_SIMD
+
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define MATH_SSE
+#endif
+
+#endif
+
+#endif
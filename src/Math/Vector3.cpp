@@ -1,5 +1,6 @@
 #include "Vector3.hpp"
 
+#include "Math/Util/FastMath.hpp"
 #include "Math/Util/MathUtil.hpp"
 #include "Quaternion.hpp"
 
@@ -18,6 +19,17 @@ namespace Math
         return *this;
     }
 
+    Vector3& Vector3::FastNormalize()
+    {
+        float inverse_len = Util::FastRSqrt(GetLengthSquared());
+
+        x *= inverse_len;
+        y *= inverse_len;
+        z *= inverse_len;
+
+        return *this;
+    }
+
     Vector3& Vector3::Rotate(const Vector3& axis, float amount)
     {
         Vector3 rotated = GetRotated(axis, amount);
@@ -80,11 +92,21 @@ namespace Math
         return std::sqrt(static_cast<float>(x * x + y * y + z * z));
     }
 
+    float Vector3::GetLengthSquared() const
+    {
+        return x * x + y * y + z * z;
+    }
+
     Vector3 Vector3::GetNormalized() const
     {
         return Vector3(*this).Normalize();
     }
 
+    Vector3 Vector3::GetFastNormalized() const
+    {
+        return Vector3(*this).FastNormalize();
+    }
+
     float Vector3::GetDistanceTo(const Vector3& other) const
     {
         Vector3 sub = Vector3(other);
@@ -28,13 +28,18 @@ namespace Math
         }
 
         Vector3& Normalize();
+        // with the approximate inverse square root of Util::FastRSqrt, for the shading, zero vectors stay zero
+        Vector3& FastNormalize();
         Vector3& Rotate(const Vector3& axis, float amount);
         Vector3& Rotate(const Quaternion& quat);
         Vector3& Lerp(const Vector3& other, float amount);
         Vector3& Round();
 
         [[nodiscard]] float GetLength() const;
+        // for comparing lengths without the square root
+        [[nodiscard]] float GetLengthSquared() const;
         [[nodiscard]] Vector3 GetNormalized() const;
+        [[nodiscard]] Vector3 GetFastNormalized() const;
         [[nodiscard]] Vector3 GetRotated(const Vector3& axis, float amount) const;
         [[nodiscard]] Vector3 GetRotated(const Quaternion& quat) const;
 
@@ -0,0 +1,13 @@
+# runs the two builds of MathResults and fails when their outputs aren't the same, cmake -DFIRST=<exe> -DSECOND=<exe> -DOUTPUT_DIR=<dir> -P
+execute_process(COMMAND ${FIRST} ${OUTPUT_DIR}/first_results.txt RESULT_VARIABLE first_result)
+execute_process(COMMAND ${SECOND} ${OUTPUT_DIR}/second_results.txt RESULT_VARIABLE second_result)
+
+if(NOT first_result EQUAL 0 OR NOT second_result EQUAL 0)
+    message(FATAL_ERROR "MathResults failed: ${first_result} ${second_result}")
+endif()
+
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${OUTPUT_DIR}/first_results.txt ${OUTPUT_DIR}/second_results.txt RESULT_VARIABLE compare_result)
+
+if(NOT compare_result EQUAL 0)
+    message(FATAL_ERROR "the SSE and the scalar results differ, see ${OUTPUT_DIR}/first_results.txt and ${OUTPUT_DIR}/second_results.txt")
+endif()
@@ -0,0 +1,128 @@
+// the approximations of FastMath.hpp at the FAST_MATH_ACCURACY this is built with, against the exact paths and the error bounds documented there
+#include "Math/Util/FastMath.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+
+using namespace Math;
+using namespace Math::Util;
+
+// the bounds of FastMath.hpp, the rsqrt one is relative and the pow one absolute
+#ifdef MATH_SSE
+static constexpr float rsqrt_bounds[] = {0.0f, 4e-7f, 3.7e-4f};
+#else
+static constexpr float rsqrt_bounds[] = {0.0f, 8.3e-7f, 6.6e-4f};
+#endif
+static constexpr float pow_bounds[] = {0.0f, 5e-5f, 3e-3f};
+
+static uint32_t failure_count = 0;
+
+static void Check(bool condition, const char* what, float value, float result, float expected)
+{
+    if (condition)
+        return;
+
+    if (failure_count++ < 10)
+        std::fprintf(stderr, "%s failed for %.9g: %.9g instead of %.9g\n", what, value, result, expected);
+}
+
+static float CheckRSqrt()
+{
+    float max_error = 0.0f;
+
+    // the squared lengths the shading normalizes, from a tiny light vector to a far away one, every 257th float of them
+    for (uint32_t bits = std::bit_cast<uint32_t>(1e-20f); bits <= std::bit_cast<uint32_t>(1e20f); bits += 257)
+    {
+        float value    = std::bit_cast<float>(bits);
+        float result   = FastRSqrt(value);
+        float expected = 1.0f / std::sqrt(value);
+        float error    = std::abs(result - expected) / expected;
+
+        max_error = std::max(max_error, error);
+
+        Check(error <= rsqrt_bounds[(int)fast_math_accuracy], "FastRSqrt", value, result, expected);
+    }
+
+    // 0 and below give the same large finite value, so a zero vector stays zero when it's normalized, NaN stays NaN
+    float zero_result = FastRSqrt(0.0f);
+
+    Check(std::isfinite(zero_result) && 0.0f * zero_result == 0.0f, "FastRSqrt", 0.0f, zero_result, std::numeric_limits<float>::max());
+    Check(FastRSqrt(-0.0f) == zero_result, "FastRSqrt", -0.0f, FastRSqrt(-0.0f), zero_result);
+    Check(FastRSqrt(-1.0f) == zero_result, "FastRSqrt", -1.0f, FastRSqrt(-1.0f), zero_result);
+    Check(FastRSqrt(1e-45f) == zero_result, "FastRSqrt", 1e-45f, FastRSqrt(1e-45f), zero_result);
+    Check(std::isnan(FastRSqrt(std::numeric_limits<float>::quiet_NaN())), "FastRSqrt", std::numeric_limits<float>::quiet_NaN(),
+          FastRSqrt(std::numeric_limits<float>::quiet_NaN()), std::numeric_limits<float>::quiet_NaN());
+
+    return max_error;
+}
+
+static float CheckPowTable()
+{
+    float max_error = 0.0f;
+
+    // the specular factors of the materials, the error grows with the exponent so the bound of x^20 holds for all of them
+    for (float exponent : {0.0f, 1.0f, 2.0f, 5.0f, 10.0f, 20.0f})
+    {
+        PowTable<> table(exponent);
+
+        for (uint32_t i = 0; i <= (1 << 20); i++)
+        {
+            float base     = (float)i / (1 << 20);
+            float result   = table.Get(base);
+            float expected = std::pow(base, exponent);
+            float error    = std::abs(result - expected);
+
+            max_error = std::max(max_error, error);
+
+            Check(error <= pow_bounds[(int)fast_math_accuracy], "PowTable::Get", base, result, expected);
+        }
+
+        // the bases outside of [0, 1] are clamped, NaN is 0
+        for (float base : {-0.0f, -1e-30f, -0.5f, -1e30f, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()})
+            Check(table.Get(base) == table.Get(0.0f), "PowTable::Get", base, table.Get(base), table.Get(0.0f));
+
+        for (float base : {1.0f + 1e-7f, 1.5f, 1e30f, std::numeric_limits<float>::infinity()})
+            Check(table.Get(base) == table.Get(1.0f), "PowTable::Get", base, table.Get(base), table.Get(1.0f));
+
+        Check(std::abs(table.Get(1.0f) - 1.0f) <= pow_bounds[(int)fast_math_accuracy], "PowTable::Get", 1.0f, table.Get(1.0f), 1.0f);
+    }
+
+    return max_error;
+}
+
+// the same as clamping and then rounding toward 0, which is what the casts it replaced did, NaN is 0
+static void CheckClampToByte()
+{
+    auto expected_byte = [](float value)
+    {
+        return std::isnan(value) ? (uint8_t)0 : (uint8_t)std::trunc(std::clamp(value, 0.0f, 255.0f));
+    };
+
+    for (int32_t i = -10 * 64; i <= 300 * 64; i++)
+    {
+        float value = (float)i / 64;
+
+        Check(ClampToByte(value) == expected_byte(value), "ClampToByte", value, ClampToByte(value), expected_byte(value));
+    }
+
+    for (float value : {-0.0f, 254.999f, 255.0f, 1e30f, -1e30f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                        std::numeric_limits<float>::quiet_NaN()})
+        Check(ClampToByte(value) == expected_byte(value), "ClampToByte", value, ClampToByte(value), expected_byte(value));
+}
+
+int main()
+{
+    float rsqrt_error = CheckRSqrt();
+    float pow_error   = CheckPowTable();
+
+    CheckClampToByte();
+
+    std::printf("accuracy %d: rsqrt within %.3g (bound %.3g), pow within %.3g (bound %.3g), %u failures\n", (int)fast_math_accuracy, rsqrt_error,
+                rsqrt_bounds[(int)fast_math_accuracy], pow_error, pow_bounds[(int)fast_math_accuracy], failure_count);
+
+    return failure_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+// InvertAffine has to give the same bits as InvertGeneral on affine matrices, the only difference allowed is the sign of a 0 (see Matrix4.hpp)
+#include "MathTestCases.hpp"
+
+#include "Math/Quaternion.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace Math;
+
+int main()
+{
+    Tests::MathTestCases test_cases;
+
+    std::vector<Matrix4> matrices;
+
+    for (const Matrix4& matrix : test_cases.GetMatrices())
+    {
+        if (matrix.IsAffine())
+            matrices.push_back(matrix);
+    }
+
+    // the model and view matrices the engine inverts
+    for (uint32_t i = 0; i < 1024; i++)
+    {
+        Vector3 axis        = Vector3(test_cases.GetRandomFloat(1.0f), test_cases.GetRandomFloat(1.0f), test_cases.GetRandomFloat(1.0f)).GetNormalized();
+        Quaternion rotation = Quaternion(axis, test_cases.GetRandomFloat(3.14159f));
+        Vector3 translation = Vector3(test_cases.GetRandomFloat(50.0f), test_cases.GetRandomFloat(50.0f), test_cases.GetRandomFloat(50.0f));
+        Vector3 scale       = Vector3(test_cases.GetRandomFloat(4.0f), test_cases.GetRandomFloat(4.0f), test_cases.GetRandomFloat(4.0f));
+
+        matrices.push_back(Matrix4().SetTranslation(translation) * Matrix4().SetQuaternionRotation(rotation) * Matrix4().SetScale(scale));
+    }
+
+    uint32_t mismatch_count    = 0;
+    uint32_t zero_sign_count   = 0;
+    uint32_t dispatch_failures = 0;
+
+    for (const Matrix4& matrix : matrices)
+    {
+        Matrix4 affine_inverse  = Matrix4(matrix).InvertAffine();
+        Matrix4 general_inverse = Matrix4(matrix).InvertGeneral();
+        Matrix4 inverse         = Matrix4(matrix).Invert();
+
+        for (uint8_t y = 0; y < 4; y++)
+        {
+            for (uint8_t x = 0; x < 4; x++)
+            {
+                uint32_t affine_bits  = std::bit_cast<uint32_t>(affine_inverse.values[y][x]);
+                uint32_t general_bits = std::bit_cast<uint32_t>(general_inverse.values[y][x]);
+
+                if (std::bit_cast<uint32_t>(inverse.values[y][x]) != affine_bits)
+                    dispatch_failures++;
+
+                if (affine_bits == general_bits)
+                    continue;
+
+                // +0 and -0
+                if ((affine_bits | general_bits) == 0x80000000u)
+                {
+                    zero_sign_count++;
+                    continue;
+                }
+
+                if (mismatch_count++ < 10)
+                    std::fprintf(stderr, "mismatch at [%u][%u]: %08x (affine) vs %08x (general)\n", y, x, affine_bits, general_bits);
+            }
+        }
+    }
+
+    std::printf("%zu affine matrices, %u zeros with the other sign, %u mismatches, %u times Invert didn't take InvertAffine\n", matrices.size(), zero_sign_count,
+                mismatch_count, dispatch_failures);
+
+    return mismatch_count == 0 && dispatch_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+// writes the bits of every float the SSE math code computes for MathTestCases, built once with SSE and once with MATH_NO_SIMD so the two can be
+// compared bit for bit
+#include "MathTestCases.hpp"
+
+#include "Engine/Rendering/Vertex.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace Engine::Rendering;
+using namespace Math;
+
+static void WriteFloat(FILE* file, float value)
+{
+    std::fprintf(file, "%08x ", std::bit_cast<uint32_t>(value));
+}
+
+static void WriteMatrix(FILE* file, const char* name, const Matrix4& matrix)
+{
+    std::fprintf(file, "%s ", name);
+
+    for (uint8_t y = 0; y < 4; y++)
+    {
+        for (uint8_t x = 0; x < 4; x++)
+            WriteFloat(file, matrix.values[y][x]);
+    }
+
+    std::fprintf(file, "\n");
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        std::fprintf(stderr, "usage: %s <output file>\n", argv[0]);
+        return 1;
+    }
+
+    FILE* file = std::fopen(argv[1], "w");
+
+    if (!file)
+        return 1;
+
+    Tests::MathTestCases test_cases;
+
+    std::vector<Matrix4> matrices = test_cases.GetMatrices();
+    std::vector<Vector3> vectors  = test_cases.GetVectors();
+
+    for (size_t i = 0; i < matrices.size(); i++)
+    {
+        const Matrix4& matrix = matrices[i];
+
+        // every edge case with every other one, the random ones with their neighbour
+        size_t other_count = i < 12 ? matrices.size() : 1;
+
+        for (size_t j = 0; j < other_count; j++)
+        {
+            const Matrix4& other = matrices[i < 12 ? j : (i + 1) % matrices.size()];
+
+            WriteMatrix(file, "product", matrix * other);
+
+            Matrix4 multiplied = matrix;
+            multiplied *= other;
+            WriteMatrix(file, "product_assign", multiplied);
+        }
+
+        WriteMatrix(file, "inverse", matrix.GetInverted());
+        WriteMatrix(file, "inverse_general", Matrix4(matrix).InvertGeneral());
+
+        const Vector3& vector = vectors[i % vectors.size()];
+
+        for (float w : {1.0f, 0.0f, -0.0f, 0.5f})
+        {
+            Vertex vertex = Vertex(vector);
+            vertex.SetW(w);
+            vertex *= matrix;
+
+            std::fprintf(file, "vertex ");
+            WriteFloat(file, vertex.GetPosition().x);
+            WriteFloat(file, vertex.GetPosition().y);
+            WriteFloat(file, vertex.GetPosition().z);
+            WriteFloat(file, vertex.GetW());
+            std::fprintf(file, "\n");
+        }
+
+        Vector3 transformed = vector * matrix;
+
+        std::fprintf(file, "vector ");
+        WriteFloat(file, transformed.x);
+        WriteFloat(file, transformed.y);
+        WriteFloat(file, transformed.z);
+        std::fprintf(file, "\n");
+    }
+
+    std::fclose(file);
+
+    return 0;
+}
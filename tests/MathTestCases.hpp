@@ -0,0 +1,94 @@
+#ifndef MATHTESTCASES_HPP
+#define MATHTESTCASES_HPP
+
+#include "Math/Matrix4.hpp"
+#include "Math/Vector3.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace Tests
+{
+    using namespace Math;
+
+    // the same values on every run and in every build, the floats are made from the bits of a fixed mt19937 sequence instead of a distribution
+    // whose results aren't the same between standard libraries
+    class MathTestCases
+    {
+    private:
+        std::mt19937 random = std::mt19937(5489u);
+
+        static constexpr uint32_t random_case_count = 4096;
+
+    public:
+        // between -range and range
+        float GetRandomFloat(float range)
+        {
+            return ((float)(random() >> 8) / (float)(1 << 24) * 2.0f - 1.0f) * range;
+        }
+
+        // the edge cases first: zeros of both signs, identity, subnormals, large values and the matrices the engine builds, then random ones
+        std::vector<Matrix4> GetMatrices()
+        {
+            std::vector<Matrix4> matrices;
+
+            matrices.push_back(Matrix4(0.0f));
+            matrices.push_back(Matrix4(-0.0f));
+            matrices.push_back(Matrix4().SetIdentity());
+            matrices.push_back(Matrix4(1e-40f));
+            matrices.push_back(Matrix4(-3e-39f));
+            matrices.push_back(Matrix4(1e18f));
+            matrices.push_back(Matrix4().SetTranslation(Vector3(-0.0f, 2.5f, -7.25f)));
+            matrices.push_back(Matrix4().SetScale(Vector3(-1.0f, 1e-20f, 3.0f)));
+            matrices.push_back(Matrix4().SetPerspectiveProjection(150, 150, 0.1f, 1000.0f, 90.0f));
+            matrices.push_back(Matrix4().SetOrthographicProjection(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f));
+            matrices.push_back(Matrix4().SetViewportMatrix(150, 150));
+
+            Matrix4 mixed_zeros = Matrix4().SetIdentity();
+            mixed_zeros.values[0][1] = -0.0f;
+            mixed_zeros.values[2][3] = -0.0f;
+            mixed_zeros.values[3][0] = -0.0f;
+            matrices.push_back(mixed_zeros);
+
+            for (uint32_t i = 0; i < random_case_count; i++)
+                matrices.push_back(GetRandomMatrix(i % 2 == 0));
+
+            return matrices;
+        }
+
+        std::vector<Vector3> GetVectors()
+        {
+            std::vector<Vector3> vectors = {Vector3(0.0f, 0.0f, 0.0f), Vector3(-0.0f, -0.0f, -0.0f), Vector3(1e-40f, -1e-40f, 0.0f), Vector3(1e18f, -1e18f, 1.0f)};
+
+            for (uint32_t i = 0; i < random_case_count; i++)
+                vectors.push_back(Vector3(GetRandomFloat(100.0f), GetRandomFloat(100.0f), GetRandomFloat(100.0f)));
+
+            return vectors;
+        }
+
+        // an affine matrix has a bottom row of 0 0 0 1
+        Matrix4 GetRandomMatrix(bool affine)
+        {
+            Matrix4 matrix;
+
+            for (uint8_t y = 0; y < 4; y++)
+            {
+                for (uint8_t x = 0; x < 4; x++)
+                    matrix.values[y][x] = GetRandomFloat(10.0f);
+            }
+
+            if (affine)
+            {
+                matrix.values[3][0] = 0.0f;
+                matrix.values[3][1] = 0.0f;
+                matrix.values[3][2] = 0.0f;
+                matrix.values[3][3] = 1.0f;
+            }
+
+            return matrix;
+        }
+    };
+}
+
+#endif